@@ -0,0 +1,100 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include "Benchmark.h"
+#include "Configuration.h"
+#include "Engine.h"
+#include "ParkController.h"
+#include "VisitorController.h"
+
+
+extern Configuration* GConfiguration;
+extern ParkController* GParkController;
+extern VisitorController* GVisitorController;
+
+
+namespace
+{
+	const unsigned kSeed = 1977;		// every run sees the same visitors and makes the same choices
+
+	const int kTickLengths[4] = { 60, 30, 15, 10 };
+
+
+	// a fresh park and population for each run; the engine changes both as the day goes on
+	double TimeDay(ParkTemplate park, int tick_seconds)
+	{
+		delete GParkController;
+		delete GVisitorController;
+
+		GParkController = new ParkController(false, GConfiguration->HandleFoodDrink, L"");
+		GVisitorController = new VisitorController(GConfiguration->VisitorCount, false, GConfiguration->HandleFoodDrink, park, false);
+
+		srand(kSeed);
+
+		GVisitorController->Run(false, L"", false, L"");
+
+		GParkController->BuildRides(park, L"");
+
+		Engine e(GConfiguration->FastPassMode,
+			GConfiguration->ParkOpenTime,
+			GConfiguration->ParkCloseTime,
+			false,
+			GConfiguration->DebugConfig.UpdateRate,
+			GConfiguration->HandleFoodDrink,
+			GConfiguration->Climate.Temperature,
+			tick_seconds);
+
+		auto start = std::chrono::steady_clock::now();
+
+		e.Run(false, false);
+
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		return elapsed.count();
+	}
+}
+
+
+namespace Benchmark
+{
+	void Run()
+	{
+		std::wcout << L"\n  Benchmark: " << GConfiguration->VisitorCount << L" visitors per park\n\n";
+		std::wcout << L"  Park  Tick (s)   Time (s)   x 60s tick\n";
+		std::wcout << L"  ----  --------  ---------  -----------\n";
+
+		for (int p = 0; p <= Constants::TemplateMaximum; p++)
+		{
+			double baseline = 0.0;
+
+			for (int t = 0; t < 4; t++)
+			{
+				double seconds = TimeDay(QWaitTypes::IntToParkTemplate(p), kTickLengths[t]);
+
+				if (t == 0)
+				{
+					baseline = seconds;
+				}
+
+				std::wcout << L"  " << std::setw(4) << p << L"  " << std::setw(8) << kTickLengths[t] << L"  "
+					<< std::fixed << std::setprecision(3) << std::setw(9) << seconds << L"  "
+					<< std::setprecision(2) << std::setw(11) << (baseline > 0.0 ? seconds / baseline : 0.0) << L"\n";
+			}
+		}
+
+		std::wcout << std::endl;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+// runs every built-in park at several engine tick lengths and reports how long each day took to
+// simulate, so the cost of a finer tick can be checked against the default one minute step
+namespace Benchmark
+{
+	void Run();
+}
\ No newline at end of file
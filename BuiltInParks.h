@@ -0,0 +1,562 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+
+
+#pragma once
+
+
+#include <array>
+#include <cstdint>
+
+#include "Constants.h"
+#include "DistanceMatrix.h"
+#include "QWaitTypes.h"
+#include "Ride.h"
+
+
+// the built-in parks as constant tables. everything BuildDerivedData() would otherwise do at start up,
+// the popularity order, the walk cache and the closest rides, is worked out by the compiler with the
+// same rules as the template loader: rides in popularity order (equal popularity keeps table order),
+// straight line walks, and closest rides by distance then ride number
+namespace BuiltInParks
+{
+	struct EntranceData
+	{
+		const wchar_t* Name;
+		int x;
+		int y;
+		int FastPassType;
+		int AverageVisitors;
+		int Adult;
+		int AdultAdvance;
+		int Children;
+		int ChildrenAdvance;
+		int Babies;
+		int BabiesAdvance;
+		int MaximumCapacity;
+	};
+
+	struct RideData
+	{
+		const wchar_t* Name;
+		RideType Type;
+		int RideLength;
+		RideExitType ExitType;
+		int ShowStartTime;			// shows only
+		int HourlyThroughput;
+		int ShowCapacity;			// shows only
+		int Popularity;
+		int x;
+		int y;
+		int FastPass;
+		int FastPassReservePercent;
+		bool AdultValid;
+		bool ChildValid;
+		bool BabyValid;
+	};
+
+	struct EateryData
+	{
+		const wchar_t* Name;
+		int Throughput;
+		bool Food;
+		bool Drink;
+		int x;
+		int y;
+		int WaitTime;
+		int AverageAdult;
+		int AverageChild;
+	};
+
+	// same parameters as ParkController::AddNewRideContinuous() and ParkController::AddNewRideShow()
+	constexpr RideData Continuous(const wchar_t* name, int ride_length, RideExitType ride_exit_type, int hourly_throughput, int popularity, int x, int y, int is_fast_pass, int fp_reserve_percent, bool AdultValid, bool ChildValid, bool BabyValid)
+	{
+		return { name, RideType::Continuous, ride_length, ride_exit_type, 0, hourly_throughput, 0, popularity, x, y, is_fast_pass, fp_reserve_percent, AdultValid, ChildValid, BabyValid };
+	}
+
+	constexpr RideData Show(const wchar_t* name, int ride_length, RideExitType ride_exit_type, int start_time_minutes, int hourly_throughput, int show_capacity, int popularity, int x, int y, int is_fast_pass, int fp_reserve_percent, bool AdultValid, bool ChildValid, bool BabyValid)
+	{
+		return { name, RideType::Show, ride_length, ride_exit_type, start_time_minutes, hourly_throughput, show_capacity, popularity, x, y, is_fast_pass, fp_reserve_percent, AdultValid, ChildValid, BabyValid };
+	}
+
+	// largest r where r * r <= n; the same as static_cast<int>(sqrt((double)n)) for any distance in a park
+	constexpr int SquareRoot(int n)
+	{
+		int root = 0;
+		int bit = 1 << 30;
+
+		while (bit > n)
+		{
+			bit >>= 2;
+		}
+
+		while (bit != 0)
+		{
+			if (n >= root + bit)
+			{
+				n -= root + bit;
+				root = (root >> 1) + bit;
+			}
+			else
+			{
+				root >>= 1;
+			}
+
+			bit >>= 2;
+		}
+
+		return root;
+	}
+
+	template <size_t R>
+	struct Derived
+	{
+		std::array<int, R> Order{};													// table index of each ride, in popularity order
+		alignas(kDistanceMatrixAlignment) std::array<uint16_t, (R + 1) * (R + 2)> Walk{};	// laid out as DistanceMatrix; the entrance is R
+		std::array<std::array<int, kClosestCacheSize>, R> Closest{};				// by position in Order
+	};
+
+	template <size_t R>
+	constexpr Derived<R> Derive(const EntranceData& entrance, const std::array<RideData, R>& rides)
+	{
+		Derived<R> derived{};
+
+		// insertion sort, so equal popularity stays in table order (as std::stable_sort)
+		for (size_t r = 0; r < R; r++)
+		{
+			size_t p = r;
+
+			while (p > 0 && rides[derived.Order[p - 1]].Popularity > rides[r].Popularity)
+			{
+				derived.Order[p] = derived.Order[p - 1];
+				p--;
+			}
+
+			derived.Order[p] = static_cast<int>(r);
+		}
+
+		for (size_t r1 = 0; r1 <= R; r1++)
+		{
+			for (size_t r2 = r1 + 1; r2 <= R; r2++)
+			{
+				int x1 = r1 == R ? entrance.x : rides[derived.Order[r1]].x;
+				int y1 = r1 == R ? entrance.y : rides[derived.Order[r1]].y;
+
+				int x2 = r2 == R ? entrance.x : rides[derived.Order[r2]].x;
+				int y2 = r2 == R ? entrance.y : rides[derived.Order[r2]].y;
+
+				int metres = SquareRoot((x1 - x2) * (x1 - x2) + (y1 - y2) * (y1 - y2));
+				int minutes = metres / Constants::WalkSpeedMetresPerMinute + 3;
+
+				size_t i = 2 * (r2 * (r2 + 1) / 2 + r1);
+
+				derived.Walk[i] = static_cast<uint16_t>(metres < 65535 ? metres : 65535);
+				derived.Walk[i + 1] = static_cast<uint16_t>(minutes < 65535 ? minutes : 65535);
+			}
+		}
+
+		// each pick is the nearest (distance, ride) after the previous pick
+		for (size_t r = 0; r < R; r++)
+		{
+			int last_distance = -1;
+			int last_ride = -1;
+
+			for (int c = 0; c < kClosestCacheSize; c++)
+			{
+				int best_distance = -1;
+				int best_ride = Constants::kNoSelectedRide;
+
+				for (size_t to = 0; to < R; to++)
+				{
+					if (to != r)
+					{
+						size_t low = to < r ? to : r;
+						size_t high = to < r ? r : to;
+
+						int distance = derived.Walk[2 * (high * (high + 1) / 2 + low)];
+						int ride = static_cast<int>(to);
+
+						bool after_last = distance > last_distance || (distance == last_distance && ride > last_ride);
+						bool before_best = best_ride == Constants::kNoSelectedRide || distance < best_distance || (distance == best_distance && ride < best_ride);
+
+						if (after_last && before_best)
+						{
+							best_distance = distance;
+							best_ride = ride;
+						}
+					}
+				}
+
+				derived.Closest[r][c] = best_ride;
+
+				last_distance = best_distance;
+				last_ride = best_ride;
+			}
+		}
+
+		return derived;
+	}
+
+
+	// == test park ===========================================================================================
+
+	constexpr EntranceData kTestEntrance = { L"Super Cat Park", 0, 0, 0, 10000,
+		8, 8, 5, 5, 0, 0, 12000 };
+
+	constexpr std::array kTestRides = {
+		Show(L"Cats throughout the ages", 30,             RideExitType::Short, 60, 2000, 2000,  1, -200,  50, 0, 0, true, true, false),
+		Show(L"Idea of a certain cat", 10,                RideExitType::Short, 15, 1000,  250, 12,    3, 300, 0, 0, true, true, false),
+
+		Continuous(L"Katzen-Kogl", 4,                     RideExitType::Short, 1800,  4, -200, 150, 0, 0, true, true, false),
+		Continuous(L"Le chat blanc", 4,                   RideExitType::Short, 1800,  2,  200, 150, 0, 0, true, true, false),
+		Continuous(L"Raminou", 4,                         RideExitType::Short, 1800, 10, -200, 250, 0, 0, true, true, false),
+		Continuous(L"White cat playing with a string", 4, RideExitType::Short, 1800,  7,  200, 250, 0, 0, true, true, false),
+		Continuous(L"Rutherford Freeman Maxwell", 4,      RideExitType::Short, 1800,  8,  200,  50, 0, 0, true, true, false),
+		Continuous(L"Siamese adventure", 4,               RideExitType::Short, 1800,  9,    0, 100, 0, 0, true, true, false),
+		Continuous(L"Fluffy cat surprise", 4,             RideExitType::Short, 1800,  5,    0, 200, 0, 0, true, true, false),
+		Continuous(L"Meow meow meow!", 4,                 RideExitType::Short, 1800,  6,    0,  50, 0, 0, true, true, false),
+	};
+
+	constexpr std::array<EateryData, 0> kTestEateries = {};
+
+	constexpr auto kTestDerived = Derive(kTestEntrance, kTestRides);
+
+
+	// == Animal Kingdom ======================================================================================
+
+	constexpr EntranceData kAnimalKingdomEntrance = { L"Animal Kingdom", 0, 0, 1, 38000,
+		118, 118, 112, 112, 0, 0, 60000 };
+
+	constexpr std::array kAnimalKingdomRides = {
+		Show(L"Feathered Friends in Flight!",           35, RideExitType::Short,       60, 1000, 1000, 12,   10, 389, 2, 70, true, true, false), // temp replaces "UP! A Great Bird Adventure"
+		Show(L"Festival of the Lion King",              30, RideExitType::Short,       60, 1500, 1500,  6, -265, 337, 2, 70, true, true, false),
+		Show(L"Finding Nemo: The Big Blue and Beyond!", 30, RideExitType::Short,       60, 1500, 1500, 11,  290, 205, 2, 70, true, true, false),
+
+		Continuous(L"Animation Academy",                23, RideExitType::Short,      110,  8, -125, 476, 0,  0, true, true, false),
+		Continuous(L"Gorilla Falls Exploration Trail",  23, RideExitType::Short,     2000,  5, -198, 476, 0,  0, true, true, false),
+		Continuous(L"DINOSAUR",                          4, RideExitType::Shop,      1800,  3,  184,  37, 2, 70, true, true, false),
+		Continuous(L"Expedition Everest",                3, RideExitType::Shop,      1900,  2,  323, 352, 2, 70, true, true, false), // 1800-2060
+		Continuous(L"Flights of Passage",                5, RideExitType::LargeShop, 1300,  1, -227,  30, 1, 70, true, true, false), // 1280-1440; exit then shop
+		Continuous(L"It's tough to be a bug",            8, RideExitType::Short,     1800,  9,  -59, 295, 2, 70, true, true, false),
+		Continuous(L"Kali River Rapids",                 4, RideExitType::Short,     1900,  7,  180, 418, 2, 70, true, true, false), // 1800-2000
+		Continuous(L"Kilimanjaro Safaris",              19, RideExitType::Short,     3000,  5, -211, 444, 2, 70, true, true, false),
+		Continuous(L"Na'vi River Journey",               5, RideExitType::Short,     1200,  4, -160,   0, 1, 70, true, true, false), // 1080-1440
+		Continuous(L"TriceraTop Spin",                   2, RideExitType::Short,      850, 10,  186, 107, 0,  0, true, true, false), // 800-900
+		Continuous(L"Wildlife Express Train",            7, RideExitType::Short,     1500,  8, -123, 476, 0,  0, true, true, false), // 1000-1250 (per station, two trains operating)
+	};
+
+	constexpr std::array kAnimalKingdomEateries = {
+		EateryData{ L"Flame Tree Barbecue", 3, true, true,  77,  220, 15, 10, 8 },
+		EateryData{ L"Picnic in the Park",  3, true, true, -79,  184, 15, 10, 8 },
+		EateryData{ L"Pizzafari",           3, true, true, -132, 205, 10, 10, 8 },
+		EateryData{ L"Rainforest Cafe",     3, true, true,  -58, -90, 15, 10, 8 },
+		EateryData{ L"Restaurantosaurus",   3, true, true,  122,  68, 15, 10, 8 },
+		EateryData{ L"Tusker House",        3, true, true, -198, 367, 15, 10, 8 },
+		EateryData{ L"Tak and Yeti",        3, true, true,   64, 371, 15, 10, 8 },
+		EateryData{ L"Royal Anandapur Tea", 3, true, false,  80, 337, 15, 10, 8 },
+	};
+
+	constexpr auto kAnimalKingdomDerived = Derive(kAnimalKingdomEntrance, kAnimalKingdomRides);
+
+
+	// == EPCOT ===============================================================================================
+
+	constexpr EntranceData kEpcotEntrance = { L"EPCOT", 0, 0, 1, 34000,
+		118, 118, 112, 112, 0, 0, 110000 };
+
+	constexpr std::array kEpcotRides = {
+		Show(L"The American Adventure", 29, RideExitType::Short, 60, 1024, 1024, 9, 0, 925, 0, 0, true, true, false),
+
+		Continuous(L"Frozen Ever After",                               5, RideExitType::Shop,  1100,  5, -274, 587, 2, 70, true, true, false), // 1100-1200
+		Continuous(L"Gran Fiesta Tour Starring the Three Caballeros",  8, RideExitType::Short, 1800,  6, -245, 435, 0,  0, true, true, false), // 1800-2000
+		Continuous(L"Guardians of the Galaxy: Cosmic Rewind",          4, RideExitType::Short, 2000,  1, -151, 192, 1, 70, true, true, false),
+		Continuous(L"Living With The Land",                           14, RideExitType::Short, 2445,  7,  324, 194, 2, 70, true, true, false),
+		Continuous(L"Mission: SPACE",                                  6, RideExitType::Shop,  1600,  8, -213, 550, 2, 70, true, true, false), // between Green and Orange teams
+		Continuous(L"O Canada!",                                      18, RideExitType::Short,  610, 11,  197, 477, 0,  0, true, true, false),
+		Continuous(L"Remys Ratatouille Adventure",                    5, RideExitType::Short, 2000,  4,  320, 820, 0,  0, true, true, false), // 2000-2200
+		Continuous(L"Soarin Around the World",                        5, RideExitType::Short, 1827,  2,  273, 332, 1, 70, true, true, false), // 1827 (official), 2000-2100 actual
+		Continuous(L"Spaceship Earth",                                15, RideExitType::Short, 2400,  3,    0,  85, 2, 70, true, true, false),
+		Continuous(L"Test Track",                                      4, RideExitType::Shop,  1600,  1, -177, 337, 1, 70, true, true, false),
+		Continuous(L"The Seas with Nemo & Friends",                    4, RideExitType::Shop,  2000, 10,  145, 124, 0,  0, true, true, false), // 2000-2200
+	};
+
+	constexpr std::array kEpcotEateries = {
+		EateryData{ L"Akershus Royal Banquet Hall", 3, true, true, 254, 638, 15, 10, 8 },
+		EateryData{ L"L'Artisan des Glaces", 3, true, true, -331, 829, 10, 10, 8 },
+		EateryData{ L"Biergarten", 3, true, true, 254, 901, 15, 10, 8 },
+		EateryData{ L"Boulangerie Patisserie", 3, true, true, -349, 842, 10, 10, 8 },
+		EateryData{ L"La Cantina", 3, true, true, 171, 561, 15, 10, 8 },
+		EateryData{ L"Le Cellier", 3, true, true, -211, 518, 15, 10, 8 },
+		EateryData{ L"Chefs de France", 3, true, true, -316, 813, 15, 10, 8 },
+		EateryData{ L"Coral Reef", 3, true, true, -109, 131, 15, 10, 8 },
+		EateryData{ L"Electric Umbrella", 3, true, true, 38, 235, 15, 10, 8 },
+		EateryData{ L"Garden Grill", 3, true, true, -263, 256, 15, 10, 8 },
+		EateryData{ L"Kringla Bakeri og Cafe", 3, true, true, 229, 609, 15, 10, 8 },
+		EateryData{ L"Liberty Inn", 3, true, true, 40, 970, 15, 10, 8 },
+		EateryData{ L"Lotus Blossom Cafe", 3, true, true, 282, 668, 15, 10, 8 },
+		EateryData{ L"Nine Dragons", 3, true, true, 254, 675, 15, 10, 8 },
+		EateryData{ L"Restaurant Marrakesh", 3, true, true, -263, 938, 15, 10, 8 },
+		EateryData{ L"Rose and Crown Pub", 3, true, true, -209, 638, 15, 10, 8 },
+		EateryData{ L"Sam Angel Inn", 3, true, true, 127, 496, 15, 10, 8 },
+		EateryData{ L"Sommerfest", 3, true, true, 231, 905, 15, 10, 8 },
+		EateryData{ L"Spice Road Table", 3, true, true, -211, 851, 15, 10, 8 },
+		EateryData{ L"Sunshine Season Food Fair", 3, true, true, -263, 256, 15, 10, 8 },
+		EateryData{ L"Tangierine Cafe", 3, true, true, -263, 878, 15, 10, 8 },
+		EateryData{ L"Teppan Edo", 3, true, true, -131, 931, 15, 10, 8 },
+		EateryData{ L"Tutto Italia", 3, true, true, 141, 960, 15, 10, 8 },
+		EateryData{ L"Via Napoli", 3, true, true, 128, 996, 15, 10, 8 },
+		EateryData{ L"Yakitori House", 3, true, true, -94, 954, 15, 10, 8 },
+		EateryData{ L"Yorkshire County Fish Shop", 3, true, true, -222, 656, 10, 10, 8 },
+
+		EateryData{ L"La Cava del Tequila", 3, false, true, 219, 514, 15, 10, 8 },
+		EateryData{ L"Club Cool", 3, false, true, -34, 319, 15, 10, 8 },
+		EateryData{ L"Tutto Gusto", 3, false, true, 137, 974, 15, 10, 8 },
+	};
+
+	constexpr auto kEpcotDerived = Derive(kEpcotEntrance, kEpcotRides);
+
+
+	// == Hollywood Studios ===================================================================================
+
+	constexpr EntranceData kHollywoodStudiosEntrance = { L"Hollywood Studios", 0, 0, 1, 31000,
+		118, 118, 112, 112, 0, 0, 60000 };
+
+	constexpr std::array kHollywoodStudiosRides = {
+		Show(L"Indiana Jones Epic Stunt Spectacular!",            30, RideExitType::Short,   60, 2000, 2000, 10, -190, 0, 2, 70, true, true, false),
+		Show(L"Muppet*Vision 3-D",                                15, RideExitType::Short,   15, 2256, 564, 8, -290, 142, 2, 70, true, true, false), // 564 per show
+
+		Continuous(L"Alien Swirling Saucers",                      2, RideExitType::Short,  600, 12, -200, 275, 2, 70, true, true, false),
+		Continuous(L"Beauty and the Beast Live on Stage",         30, RideExitType::Shop,   100, 11,  118,  23, 2, 70, true, true, false),
+		Continuous(L"Lightning McQueen's Racing Academy",         10, RideExitType::Short, 1500, 14,  203,  89, 0,  0, true, true, false), // guess
+		Continuous(L"Mickey & Minnies Runaway Railway",           5, RideExitType::Short, 1800,  6, -122, 105, 1, 70, true, true, false), // 1800-2000
+		Continuous(L"Millennium Falcon: Smugglers Run",            5, RideExitType::Short, 1700,  7, -405, 412, 1, 70, true, true, false),
+		Continuous(L"Rock n Roller Coaster Starring Aerosmith",  2, RideExitType::Shop,  1400,  5,  221,  76, 2, 70, true, true, false), // 1400-1600
+		Continuous(L"Slinky Dog Dash",                             2, RideExitType::Short, 1440,  4,   70, 384, 1, 70, true, true, false),
+		Continuous(L"Star Tours The Adventures Continue",          5, RideExitType::Shop,  1890,  9, -270,  72, 2, 70, true, true, false), // 1800-1950
+		Continuous(L"Star Wars: Rise of the Resistance",          18, RideExitType::Short, 1300,  1, -323, 243, 2, 70, true, true, false), // 1300-1700
+		Continuous(L"The Twilight Zone Tower of Terror",          50, RideExitType::Shop,  1700,  2,  176,   5, 2, 70, true, true, false),
+		Continuous(L"Toy Story Midway Mania!",                     8, RideExitType::Short, 1600,  3, -155, 261, 2, 70, true, true, false), // 1600-1700
+		Continuous(L"Voyage of the Little Mermaid",               15, RideExitType::Short, 1900, 12,  -25, 192, 2, 70, true, true, false),
+	};
+
+	constexpr std::array kHollywoodStudiosEateries = {
+		EateryData{ L"50's Prime-Time Cafe", 3, true, true, -91, 18, 15, 10, 8 },
+		EateryData{ L"ABC Commissary", 3, true, true, -166, 161, 15, 10, 8 },
+		EateryData{ L"Backlot Express", 3, true, true, -250, 35, 10, 10, 8 },
+		EateryData{ L"The Hollywood Brown Derby", 3, true, true, -27, 144, 15, 10, 8 },
+		EateryData{ L"Hollywood and Vine", 3, true, true, -43, 40, 15, 10, 8 },
+		EateryData{ L"Mama Melrose's", 3, true, true, -387, 147, 15, 10, 8 },
+		EateryData{ L"Rizzo's Pizza", 3, true, true, -320, 113, 15, 10, 8 },
+		EateryData{ L"Sci-Fi Dine-in Theater", 3, true, true, -229, 143, 15, 10, 8 },
+		EateryData{ L"Starring Rolls Cafe", 3, true, true, 10, 108, 15, 10, 8 },
+		EateryData{ L"Sunset Blvd. Courtyard", 3, true, true, 127, 105, 15, 10, 8 },
+		EateryData{ L"Hollywood Brown Derby Lounge", 3, false, true, -26, 127, 15, 10, 8 },
+		EateryData{ L"Trolly Car Cafe", 3, false, true, -18, 77, 15, 10, 8 },
+		EateryData{ L"Tune-in Lounge", 3, false, true, -70, 29, 15, 10, 8 },
+	};
+
+	constexpr auto kHollywoodStudiosDerived = Derive(kHollywoodStudiosEntrance, kHollywoodStudiosRides);
+
+
+	// == Magic Kingdom =======================================================================================
+
+	constexpr EntranceData kMagicKingdomEntrance = { L"Magic Kingdom", 0, 0, 3, 57000,
+		118, 118, 112, 112, 0, 0, 100000 };
+
+	constexpr std::array kMagicKingdomRides = {
+		Continuous(L"its a small world",                           11, RideExitType::Short, 2000,  9,  -73, 428, 3, 70, true, true, false), // the best ride in the whole universe
+		Continuous(L"Astro Orbiter",                                 2, RideExitType::Short,  300, 15,  270, 201, 0,  0, true, true, false),
+		Continuous(L"Big Thunder Mountain Railroad",                 4, RideExitType::Short, 1400,  2, -338, 363, 3, 70, true, true, false),
+		Continuous(L"Buzz Lightyear Space Ranger Spin",              4, RideExitType::Shop,  1200,  9,  167, 165, 3, 70, true, true, false),
+		Continuous(L"Dumbo the Flying Elephant",                     2, RideExitType::Short, 1200, 10,  219, 409, 3, 70, true, true, false),
+		Continuous(L"Jungle Cruise",                                10, RideExitType::Short, 1200,  6, -225, 156, 3, 70, true, true, false), // 1200 (official) 1350-1450 actual
+		Continuous(L"Liberty Square Riverboat",                     13, RideExitType::Short,  900, 13, -164, 328, 0,  0, true, true, false),
+		Continuous(L"Mad Tea Party",                                 2, RideExitType::Short,  900, 11,  137, 368, 3, 70, true, true, false), // 900-1000
+		Continuous(L"Peter Pans Flight",                            3, RideExitType::Short, 1075,  8,  -77, 407, 3, 70, true, true, false), // 1075-1200
+		Continuous(L"Pirates of the Caribbean",                      9, RideExitType::Shop,  3400,  7, -300, 170, 3, 70, true, true, false),
+		Continuous(L"Prince Charming Regal Carrousel",               2, RideExitType::Short,  700, 12,    0, 377, 0,  0, true, true, false), // 700-1000
+		Continuous(L"Space Mountain",                                3, RideExitType::Shop,  2000,  5,  316, 275, 3, 70, true, true, false),
+		Continuous(L"Splash Mountain",                              11, RideExitType::Shop,  1800,  3, -400, 290, 3, 70, true, true, false),
+		Continuous(L"The Haunted Mansion",                           8, RideExitType::Short, 2400,  1, -186, 408, 3, 70, true, true, false),
+		Continuous(L"The Many Adventures of Winnie the Pooh",        4, RideExitType::Shop,   600, 13,   87, 390, 3, 70, true, true, false), // 600-800
+		Continuous(L"Tomorrowland Transit Authority Peoplemover",   10, RideExitType::Short, 3600,  4,  188, 194, 0,  0, true, true, false),
+		Continuous(L"Under the Sea: Journey of the Little Mermaid",  7, RideExitType::Short, 1800, 17,  142, 472, 3, 70, true, true, false), // 1800-1994
+		Continuous(L"Walt Disneys Carousel of Progress",           21, RideExitType::Short, 3600, 16,  190, 114, 0,  0, true, true, false), // 240 per show
+	};
+
+	constexpr std::array kMagicKingdomEateries = {
+		EateryData{ L"Be Our Guest", 3, true, true, 34, 517, 15, 10, 8 },
+		EateryData{ L"Casey's Corner", 3, true, true, 8, 144, 15, 10, 8 },
+		EateryData{ L"Cinderall's Royal Table", 3, true, true, 12, 327, 15, 10, 8 },
+		EateryData{ L"Columbia Harbour House", 3, true, true, -145, 387, 15, 10, 8 },
+		EateryData{ L"Crystal Palace", 3, true, true, 127, 306, 15, 10, 8 },
+		EateryData{ L"Gaston's Tavern", 3, true, true, -73, 150, 15, 10, 8 },
+		EateryData{ L"Goldern Oak Outpost", 3, true, true, 62, 525, 15, 10, 8 },
+		EateryData{ L"Liberty Tree Tavern", 3, true, true, -356, 227, 15, 10, 8 },
+		EateryData{ L"Main Street Bakery", 3, true, true, -133, 265, 15, 10, 8 },
+		EateryData{ L"Main Street Confectionary", 3, true, true, 8, 51, 10, 10, 8 },
+		EateryData{ L"Pecos Bill Tall Tale Cafe", 3, true, true, -323, 231, 15, 10, 8 },
+		EateryData{ L"Pinocchio Village Haus", 3, true, true, -20, 433, 15, 10, 8 },
+		EateryData{ L"Plaza Ice Cream", 3, true, true, 25, 128, 10, 10, 8 },
+		EateryData{ L"Tomorrowland Terrace", 3, true, true, 80, 170, 15, 10, 8 },
+		EateryData{ L"Tony's Town Square Restaurant", 3, true, true, 45, 19, 15, 10, 8 },
+		EateryData{ L"Tortuga Tavern", 3, true, true, -292, 191, 15, 10, 8 },
+	};
+
+	constexpr auto kMagicKingdomDerived = Derive(kMagicKingdomEntrance, kMagicKingdomRides);
+
+
+	// == Coin-op arcade ======================================================================================
+
+	constexpr EntranceData kArcadeEntrance = { L"Arcade", 0, 0, 0, 5000,
+		5, 5, 5, 5, 0, 0, 6000 };
+
+	constexpr std::array kArcadeRides = {
+		Continuous(L"Outrun",            2, RideExitType::Short, 120, 1, -20, 10, 0, 0, true, true, false),
+		Continuous(L"Pac-Man",           2, RideExitType::Short, 120, 1, -10, 10, 0, 0, true, true, false),
+		Continuous(L"Ghosts n Goblins",  2, RideExitType::Short, 120, 1,   0, 10, 0, 0, true, true, false),
+		Continuous(L"Bubble Bobble",     2, RideExitType::Short, 120, 1, -10, 10, 0, 0, true, true, false),
+		Continuous(L"Golden Axe",        2, RideExitType::Short, 120, 1, -20, 10, 0, 0, true, true, false),
+
+		Continuous(L"Afterburner",       2, RideExitType::Short, 120, 1, -20, 20, 0, 0, true, true, false),
+		Continuous(L"Afterburner II",    2, RideExitType::Short, 120, 1, -10, 20, 0, 0, true, true, false),
+		Continuous(L"Galaxian",          2, RideExitType::Short, 120, 1,   0, 20, 0, 0, true, true, false),
+		Continuous(L"Samurai Shodown 2", 2, RideExitType::Short, 120, 1, -10, 20, 0, 0, true, true, false),
+		Continuous(L"Virtua Cop",        2, RideExitType::Short, 120, 1, -20, 20, 0, 0, true, true, false),
+
+		Continuous(L"Final Fight",       3, RideExitType::Short, 120, 1, -20, 30, 0, 0, true, true, false),
+		Continuous(L"Op Wolf",           3, RideExitType::Short, 120, 1, -10, 30, 0, 0, true, true, false),
+		Continuous(L"Mortal Kombat",     3, RideExitType::Short, 120, 1,   0, 30, 0, 0, true, true, false),
+		Continuous(L"Growl",             3, RideExitType::Short, 120, 1, -10, 30, 0, 0, true, true, false),
+		Continuous(L"Street Fighter",    3, RideExitType::Short, 120, 1, -20, 30, 0, 0, true, true, false),
+
+		Continuous(L"Gauntlet",          2, RideExitType::Short, 120, 1, -20, 40, 0, 0, true, true, false),
+		Continuous(L"1942",              2, RideExitType::Short, 120, 1, -10, 40, 0, 0, true, true, false),
+		Continuous(L"Rampage",           2, RideExitType::Short, 120, 1,   0, 40, 0, 0, true, true, false),
+		Continuous(L"Bomb Jack",         2, RideExitType::Short, 120, 1, -10, 40, 0, 0, true, true, false),
+		Continuous(L"Tekken",            2, RideExitType::Short, 120, 1, -20, 40, 0, 0, true, true, false),
+
+		Continuous(L"Space Invaders",    2, RideExitType::Short, 120, 1, -20, 50, 0, 0, true, true, false),
+		Continuous(L"Powerdrift",        2, RideExitType::Short, 120, 1, -10, 50, 0, 0, true, true, false),
+		Continuous(L"Metal Slug",        2, RideExitType::Short, 120, 1,   0, 50, 0, 0, true, true, false),
+		Continuous(L"R-Type",            2, RideExitType::Short, 120, 1, -10, 50, 0, 0, true, true, false),
+		Continuous(L"Galaga",            2, RideExitType::Short, 120, 1, -20, 50, 0, 0, true, true, false),
+	};
+
+	constexpr std::array<EateryData, 0> kArcadeEateries = {};
+
+	constexpr auto kArcadeDerived = Derive(kArcadeEntrance, kArcadeRides);
+
+
+	// == Alton Towers UK =====================================================================================
+
+	constexpr EntranceData kAltonTowersEntrance = { L"Alton Towers", 100, 740, 0, 25000,
+		80, 44, 74, 44, 0, 0, 28000 };
+
+	constexpr std::array kAltonTowersRides = {
+		Show(L"The Alton Towers Dungeon", 45, RideExitType::Short, 60, 1000, 1000, 10, 0, 0, 0, 0, true, true, false),
+
+		Continuous(L"The Smiler",                            3, RideExitType::Shop,  1200,  1, -118, 352, 1, 70, true, true,  false),
+		Continuous(L"Nemesis",                               2, RideExitType::Short, 1400,  2,  733, 296, 1, 70, true, true,  false),
+		Continuous(L"Oblivion",                              2, RideExitType::Short, 1900,  3, -170, 268, 1, 70, true, false, false),
+		Continuous(L"Rita",                                  1, RideExitType::Short, 1150,  4,  265,  86, 1, 70, true, false, false),
+		Continuous(L"Th13teen",                              2, RideExitType::Short, 1100,  5,  223,  82, 1, 70, true, true,  false),
+		Continuous(L"Enterprise",                            2, RideExitType::Short, 1400,  6, -196, 361, 1, 70, true, false, false),
+		Continuous(L"Galactica",                             2, RideExitType::Short, 1500,  7,  796, 158, 1, 70, true, false, false),
+		Continuous(L"Wicker Man",                            2, RideExitType::Short,  952,  8,  308, 559, 1, 70, true, true,  false),
+		Continuous(L"Hex: The Legend of the Towers",         6, RideExitType::Short,  500,  9,   77, 156, 1, 70, true, true,  false), // 78 per vault
+		Continuous(L"Spinball Whizzer",                      2, RideExitType::Short,  950, 10,  -30, 523, 1, 70, true, true,  false),
+
+		Continuous(L"Runaway Train",                         2, RideExitType::Short, 1100, 11,  549, 614, 1, 70, true, true,  false),
+		Continuous(L"Duel: The Haunted House Strikes Back!", 6, RideExitType::Short, 1920, 12,  686, 556, 1, 70, true, true,  false),
+		Continuous(L"Congo River Rapids",                    6, RideExitType::Short, 1800, 13,  442, 565, 1, 70, true, true,  false),
+		Continuous(L"Battle Galleons",                       3, RideExitType::Short,  800, 14,  237, 467, 0,  0, true, true,  false),
+		Continuous(L"The Blade",                             2, RideExitType::Short, 1300, 15,  661, 296, 1, 70, true, true,  false),
+		Continuous(L"Raj's Bouncy Bottom Burp",              2, RideExitType::Short,  200, 16,    0, 127, 0,  0, true, true,  false),
+		Continuous(L"Heave Ho!",                             2, RideExitType::Short,  600, 17,  216, 601, 0,  0, true, true,  false),
+		Continuous(L"The Royal Carousel",                    2, RideExitType::Short,  450, 18,   -7,  51, 0,  0, true, true,  false),
+		Continuous(L"Marauder's Mayhem",                     2, RideExitType::Short, 1200, 19,  244, 594, 0,  0, true, true,  false),
+		Continuous(L"Spinjam",                               2, RideExitType::Short,  950, 20, -195, 317, 0,  0, true, true,  false),
+
+		Continuous(L"Gangsta Granny: The Ride",              2, RideExitType::Short, 1100, 21,   23,  87, 1, 70, true, true,  false),
+		Continuous(L"Flavio's Fabulous Fandango",            2, RideExitType::Short,  950, 22,   57,  75, 0,  0, true, true,  false), //guess
+		Continuous(L"Cuckoo Cars Driving School",            4, RideExitType::Short,  450, 23,   41, 125, 0,  0, true, true,  false),
+		Continuous(L"Octonauts Rollercoaster Adventure",     2, RideExitType::Short,  580, 24,   40, 567, 0,  0, true, true,  false),
+		Continuous(L"Funk'n'Fly",                            2, RideExitType::Short,  480, 25,  700, 245, 0,  0, true, true,  false),
+		Continuous(L"Skyride",                               5, RideExitType::Short, 2800, 26,  158, 618, 0,  0, true, true,  false),
+	};
+
+	constexpr std::array kAltonTowersEateries = {
+		EateryData{ L"Tower's Street Hot Dogs", 3, true, true, 16, 70, 10, 10, 8 },
+		EateryData{ L"Corner Coffee", 3, false, true, -36, 78, 10, 10, 8 },
+		EateryData{ L"Eastern Express", 3, true, true, 175, 113, 15, 10, 8 },
+		EateryData{ L"Donut Factory", 3, true, true, -231, 268, 10, 10, 8 },
+		EateryData{ L"Woodcutter's Bar and Grill", 3, true, true, 15, 434, 15, 10, 8 },
+		EateryData{ L"Pizza and Pasta", 3, true, true, 434, 107, 15, 10, 8 },
+		EateryData{ L"Just Chicken", 3, true, true, -199, 424, 15, 10, 8 },
+		EateryData{ L"Nemice's Donuts", 3, true, true, 487, 415, 10, 10, 8 },
+		EateryData{ L"Rollercoaster", 3, true, true, 634, 512, 15, 10, 8 },
+		EateryData{ L"Little Explorer's Lunchbox", 3, true, true, -74, 17, 15, 10, 8 },
+		EateryData{ L"Coffee Lounge", 3, false , true, -39, 719, 15, 10, 8 },
+		EateryData{ L"Burger Kitchen", 3, true, true, 609, 467, 10, 10, 8 },
+		EateryData{ L"Welcom-Inn", 2, true, true, 162, 185, 15, 10, 8 },
+		EateryData{ L"Courtyard Nachos/Waffles/Hotdogs", 3, true, true, 162, 185, 10, 10, 8 },
+		EateryData{ L"Wafflemeister", 2, true, true, 380, 375, 15, 10, 8 },
+		EateryData{ L"Nitrogenie", 2, true, true, 510, 209, 10, 10, 8 },
+
+		EateryData{ L"Vending Machines", 8, false, true, -229, 268, 5, 1, 1 },
+	};
+
+	constexpr auto kAltonTowersDerived = Derive(kAltonTowersEntrance, kAltonTowersRides);
+
+	// a built-in park without its sizes
+	struct BuiltInPark
+	{
+		const EntranceData* Entrance;
+		const RideData* Rides;
+		int RideCount;
+		const EateryData* Eateries;
+		int EateryCount;
+
+		const int* Order;
+		const uint16_t* Walk;
+		const std::array<int, kClosestCacheSize>* Closest;
+	};
+
+	template <size_t R, size_t E>
+	constexpr BuiltInPark MakePark(const EntranceData& entrance, const std::array<RideData, R>& rides, const std::array<EateryData, E>& eateries, const Derived<R>& derived)
+	{
+		return { &entrance, rides.data(), static_cast<int>(R), eateries.data(), static_cast<int>(E), derived.Order.data(), derived.Walk.data(), derived.Closest.data() };
+	}
+
+	constexpr BuiltInPark Get(ParkTemplate park_template)
+	{
+		switch (park_template)
+		{
+		case ParkTemplate::WDWAnimalKingdom:
+			return MakePark(kAnimalKingdomEntrance, kAnimalKingdomRides, kAnimalKingdomEateries, kAnimalKingdomDerived);
+		case ParkTemplate::WDWEpcot:
+			return MakePark(kEpcotEntrance, kEpcotRides, kEpcotEateries, kEpcotDerived);
+		case ParkTemplate::WDWHollywoodStudios:
+			return MakePark(kHollywoodStudiosEntrance, kHollywoodStudiosRides, kHollywoodStudiosEateries, kHollywoodStudiosDerived);
+		case ParkTemplate::WDWMagicKingdom:
+			return MakePark(kMagicKingdomEntrance, kMagicKingdomRides, kMagicKingdomEateries, kMagicKingdomDerived);
+		case ParkTemplate::Arcade:
+			return MakePark(kArcadeEntrance, kArcadeRides, kArcadeEateries, kArcadeDerived);
+		case ParkTemplate::AltonTowers:
+			return MakePark(kAltonTowersEntrance, kAltonTowersRides, kAltonTowersEateries, kAltonTowersDerived);
+		}
+
+		return MakePark(kTestEntrance, kTestRides, kTestEateries, kTestDerived);
+	}
+}
\ No newline at end of file
@@ -17,6 +17,8 @@
 #include "Configuration.h"
 #include "Constants.h"
 #include "Ini.h"
+#include "ParkImage.h"
+#include "PopulationFile.h"
 #include "QWaitTypes.h"
 #include "Utility.h"
 
@@ -70,14 +72,19 @@ void Configuration::SetDefaults()
 	DebugReports.SelectionChoiceCache = false;
 	DebugConfig.NoExecution = false;
 	DebugConfig.DisableConsoleOutput = false;
+	DebugConfig.Benchmark = false;
+	DebugConfig.Profile = false;
 
 	CSVReports.MinuteByMinute = false;
 	CSVReports.CompleteVisitorData = false;
 	CSVReports.VisitorLocation = false;
 	CSVReports.VisitorDemographics = false;
 	CSVReports.VisitorRideList = false;
+	CSVReports.Compress = false;
+	CSVReports.EncodeNames = false;
 
 	HTMLReports.SimulationReport = false;
+	HTMLReports.Compact = false;
 	HTMLReports.SimulationReportFile = L"";
 
 	TextReports.SimulationReport = false;
@@ -85,9 +92,14 @@ void Configuration::SetDefaults()
 	Input.VisitorDemographics = false;
 	Input.VisitorDemographicsFile = L"";
 
+	UseParkCache = false;
+	ParkCacheFolder = L"";
+
 	ParkOpenTime = 9;
 	ParkCloseTime = 22;
 	ParkOpenHours = ParkCloseTime - ParkOpenTime;
+
+	TickSeconds = 60;
 }
 
 
@@ -113,6 +125,18 @@ void Configuration::SetFromCommandLine()
 			{
 				HandleFoodDrink = true;
 			}
+			else if (Parameters[p].command.find(kReportCompress) != std::wstring::npos)
+			{
+				CSVReports.Compress = true;
+			}
+			else if (Parameters[p].command.find(kReportHTMLCompact) != std::wstring::npos)
+			{
+				HTMLReports.Compact = true;
+			}
+			else if (Parameters[p].command.find(kReportEncodeNames) != std::wstring::npos)
+			{
+				CSVReports.EncodeNames = true;
+			}
 			else if (Parameters[p].command.find(kReportCVD) != std::wstring::npos)
 			{
 				CSVReports.CompleteVisitorData = true;
@@ -142,6 +166,14 @@ void Configuration::SetFromCommandLine()
 			{
 				GetVisitorNames = true;
 			}
+			else if (Parameters[p].command.find(kBenchmark) != std::wstring::npos)
+			{
+				DebugConfig.Benchmark = true;
+			}
+			else if (Parameters[p].command.find(kProfile) != std::wstring::npos)
+			{
+				DebugConfig.Profile = true;
+			}
 			else if (Parameters[p].command.find(kDebugUpdateRate) != std::wstring::npos)
 			{
 				HandleDebugUpdateRate(stoi(Parameters[p].property));
@@ -150,6 +182,10 @@ void Configuration::SetFromCommandLine()
 			{
 				HandleImportVisitorDemo(Parameters[p].property);
 			}
+			else if (Parameters[p].command.find(kExpandList) != std::wstring::npos)
+			{
+				HandleExpandList(Parameters[p].property);
+			}
 			else if (Parameters[p].command.find(kReportSimulationHTML) != std::wstring::npos)
 			{
 				HandleSimulationReportHTML(Parameters[p].property);
@@ -182,6 +218,18 @@ void Configuration::SetFromCommandLine()
 			{
 				HandleTemperature(Parameters[p].property);
 			}
+			else if (Parameters[p].command.find(kParkCache) != std::wstring::npos)
+			{
+				HandleParkCache(Parameters[p].property);
+			}
+			else if (Parameters[p].command.find(kCompileTemplate) != std::wstring::npos)
+			{
+				HandleCompileTemplate(Parameters[p].property);
+			}
+			else if (Parameters[p].command.find(kTickSeconds) != std::wstring::npos)
+			{
+				HandleTickSeconds(Parameters[p].property);
+			}
 		}
 	}
 }
@@ -204,7 +252,14 @@ void Configuration::HandleImportVisitorDemo(const std::wstring file_name)
 {
 	if (file_name != L"")
 	{
-		Input.VisitorDemographicsFile = SetExtension(file_name, L".csv");
+		if (PopulationFile::IsPopulationFile(file_name))
+		{
+			Input.VisitorDemographicsFile = file_name;
+		}
+		else
+		{
+			Input.VisitorDemographicsFile = SetExtension(file_name, L".csv");
+		}
 
 		Input.VisitorDemographics = true;
 	}
@@ -215,6 +270,21 @@ void Configuration::HandleImportVisitorDemo(const std::wstring file_name)
 }
 
 
+void Configuration::HandleExpandList(const std::wstring file_name)
+{
+	if (file_name != L"")
+	{
+		Input.ExpandListFile = file_name;
+
+		Input.ExpandList = true;
+	}
+	else
+	{
+		std::wcerr << L"Error, no encoded list file specified." << std::endl;
+	}
+}
+
+
 void Configuration::HandleSimulationReportHTML(const std::wstring file_name)
 {
 	if (file_name != L"")
@@ -236,7 +306,14 @@ void Configuration::HandleReportVisitorDemo(const std::wstring file_name)
 {
 	if (file_name != L"")
 	{
-		CSVReports.VisitorDemographicsFile = SetExtension(file_name, L".csv");
+		if (PopulationFile::IsPopulationFile(file_name))
+		{
+			CSVReports.VisitorDemographicsFile = file_name;
+		}
+		else
+		{
+			CSVReports.VisitorDemographicsFile = SetExtension(file_name, L".csv");
+		}
 
 		CSVReports.VisitorDemographics = true;
 	}
@@ -251,7 +328,14 @@ void Configuration::HandleTemplateFile(const std::wstring file_name)
 {
 	if (file_name != L"")
 	{
-		RideTemplateFile = SetExtension(file_name, L".template");
+		if (ParkImage::IsParkImage(file_name))
+		{
+			RideTemplateFile = file_name;
+		}
+		else
+		{
+			RideTemplateFile = SetExtension(file_name, L".template");
+		}
 	}
 	else
 	{
@@ -371,6 +455,59 @@ void Configuration::HandleTemperature(const std::wstring input)
 }
 
 
+// no folder uses the current folder
+void Configuration::HandleParkCache(const std::wstring folder)
+{
+	ParkCacheFolder = folder;
+
+	if (ParkCacheFolder == L"")
+	{
+		ParkCacheFolder = L".";
+	}
+
+	UseParkCache = true;
+}
+
+
+void Configuration::HandleCompileTemplate(const std::wstring file_name)
+{
+	if (file_name != L"")
+	{
+		Input.CompileTemplateFile = SetExtension(file_name, kParkImageExtension);
+
+		Input.CompileTemplate = true;
+	}
+	else
+	{
+		std::wcerr << L"Error, no park image file specified." << std::endl;
+	}
+}
+
+
+// the minute has to split in to whole ticks: 1, 2, 3, 4, 5, 6, 10, 12, 15, 20, 30 or 60 seconds
+void Configuration::HandleTickSeconds(const std::wstring input)
+{
+	try
+	{
+		int t = std::stoi(input);
+
+		if (t > 0 && t <= 60 && 60 % t == 0)
+		{
+			TickSeconds = t;
+
+			return;
+		}
+	}
+	catch (...)
+	{
+	}
+
+	std::wcerr << L"Error, invalid tick length \"" << input << L"\" (must divide 60 seconds). Using 60 (default)." << std::endl;
+
+	TickSeconds = 60;
+}
+
+
 std::wstring Configuration::GetCommandValue(const std::wstring input)
 {
 	size_t pos = input.find(';');
@@ -423,6 +560,18 @@ bool Configuration::IsValidParameter(const std::wstring input)
 	{
 		return true;
 	}
+	else if (parameter == kReportCompress)
+	{
+		return true;
+	}
+	else if (parameter == kReportHTMLCompact)
+	{
+		return true;
+	}
+	else if (parameter == kReportEncodeNames)
+	{
+		return true;
+	}
 	else if (parameter == kReportMxMCSV)
 	{
 		return true;
@@ -447,6 +596,14 @@ bool Configuration::IsValidParameter(const std::wstring input)
 	{
 		return true;
 	}
+	else if (parameter == kBenchmark)
+	{
+		return true;
+	}
+	else if (parameter == kProfile)
+	{
+		return true;
+	}
 	else if (parameter.find(kDebugUpdateRate) != std::wstring::npos)
 	{
 		return true;
@@ -455,6 +612,10 @@ bool Configuration::IsValidParameter(const std::wstring input)
 	{
 		return true;
 	}
+	else if (parameter.find(kExpandList) != std::wstring::npos)
+	{
+		return true;
+	}
 	else if (parameter.find(kReportSimulationHTML) != std::wstring::npos)
 	{
 		return true;
@@ -487,6 +648,18 @@ bool Configuration::IsValidParameter(const std::wstring input)
 	{
 		return true;
 	}
+	else if (parameter.find(kParkCache) != std::wstring::npos)
+	{
+		return true;
+	}
+	else if (parameter.find(kCompileTemplate) != std::wstring::npos)
+	{
+		return true;
+	}
+	else if (parameter.find(kTickSeconds) != std::wstring::npos)
+	{
+		return true;
+	}
 
 	return false;
 }
@@ -520,19 +693,34 @@ bool Configuration::LoadConfigurationFromIni(const std::wstring file_name)
 		int po = config->ReadInteger(L"main", L"ParkOpenTime", 9);
 		int pc = config->ReadInteger(L"main", L"ParkCloseTime", 22);
 
+		int ts = config->ReadInteger(L"main", L"TickSeconds", 60);
+
+		std::wstring park_cache = config->ReadString(L"main", L"ParkCacheFolder", L"");
+
+		if (park_cache != L"")
+		{
+			HandleParkCache(park_cache);
+		}
+
+		HandleTickSeconds(std::to_wstring(ts));
+
 		// == reports ============================================================================================
 
 		DebugReports.DistanceCache = config->ReadBoolean(L"reports", L"DebugDistanceCache", false);
 		DebugReports.SelectionChoiceCache = config->ReadBoolean(L"reports", L"DebugSelectionChoiceCache", false);
 		DebugConfig.UpdateRate = config->ReadInteger(L"reports", L"DebugUpdateRate", 15);
 		DebugConfig.NoExecution = config->ReadBoolean(L"reports", L"DebugNoExecution", false);
+		DebugConfig.Profile = config->ReadBoolean(L"reports", L"DebugProfile", false);
 
 		CSVReports.MinuteByMinute = config->ReadBoolean(L"reports", L"ReportMinuteByMinute", false);
 		CSVReports.CompleteVisitorData = config->ReadBoolean(L"reports", L"ReportCompleteVisitorData", false);
 		CSVReports.VisitorLocation = config->ReadBoolean(L"reports", L"ReportVisitorLocation", false);
 		CSVReports.VisitorRideList = config->ReadBoolean(L"reports", L"ReportVisitorRideList", false);
+		CSVReports.Compress = config->ReadBoolean(L"reports", L"ReportCompress", false);
+		CSVReports.EncodeNames = config->ReadBoolean(L"reports", L"ReportEncodeNames", false);
 
 		HTMLReports.SimulationReport = config->ReadBoolean(L"reports", L"ReportHTML", false);
+		HTMLReports.Compact = config->ReadBoolean(L"reports", L"ReportHTMLCompact", false);
 
 		TextReports.MinuteByMinute = config->ReadBoolean(L"reports", L"ReportTextMXM", false);
 		TextReports.SimulationReport = config->ReadBoolean(L"reports", L"SimulationReport", false);
@@ -28,14 +28,18 @@ static const std::wstring kDebugSCC = L"/debugscc";
 static const std::wstring kDebugDistanceCache = L"/debugdistancecache";
 static const std::wstring kDegbugNoExecute = L"/debugnoexecute";
 static const std::wstring kDebugUpdateRate = L"/debugupdaterate";
+static const std::wstring kReportCompress = L"/reportcompress";
 static const std::wstring kReportCVD = L"/reportcvd";
+static const std::wstring kReportEncodeNames = L"/encodenames";
 static const std::wstring kReportMxMCSV = L"/reportcsvmxm";
 static const std::wstring kReportMxMText = L"/reporttextmxm";
 static const std::wstring kReportSimulation = L"/reportsimulation";
 static const std::wstring kReportSimulationHTML = L"/reporthtml";
+static const std::wstring kReportHTMLCompact = L"/htmlcompact";
 static const std::wstring kReportVisitorLocation = L"/reportvisitorlocation";
 static const std::wstring kReportVisitorRideList = L"/reportvisitorridelist";
 static const std::wstring kImportVisitorDemo = L"/importvisitordemo";
+static const std::wstring kExpandList = L"/expandlist";
 static const std::wstring kReportVisitorDemo = L"/reportvisitordemo";
 static const std::wstring kTemplateFile = L"/templatefile";
 static const std::wstring kTemplate = L"/template";
@@ -45,6 +49,11 @@ static const std::wstring kFoodDrink = L"/fooddrink";
 static const std::wstring kTemperature = L"/temperature";
 static const std::wstring kUserConfigFile = L"/useconfigfile";
 static const std::wstring kGetVisitorNames = L"/getvisitornames";
+static const std::wstring kParkCache = L"/parkcache";
+static const std::wstring kCompileTemplate = L"/compiletemplate";
+static const std::wstring kTickSeconds = L"/tickseconds";
+static const std::wstring kBenchmark = L"/benchmark";
+static const std::wstring kProfile = L"/profile";
 
 
 const static int VisitorCountUseParkAverage = -1;
@@ -65,6 +74,8 @@ struct DebugOutput {
 struct DebugOptions {
 	bool NoExecution = false;
 	bool DisableConsoleOutput = false;
+	bool Benchmark = false;		// time each built-in park at several tick lengths, then exit
+	bool Profile = false;		// time each part of the run and report where it went
 
 	int UpdateRate = 15;
 };
@@ -77,6 +88,9 @@ struct CSVOutput {
 	bool VisitorDemographics = false;
 	bool VisitorRideList = false;
 
+	bool Compress = false;		// gzip the large csv reports as they are written
+	bool EncodeNames = false;	// ride/eatery lists write a name dictionary then indices
+
 	std::wstring VisitorDemographicsFile = L"";
 };
 
@@ -89,6 +103,7 @@ struct TextOutput {
 
 struct HTMLOutput {
 	bool SimulationReport = false;
+	bool Compact = false;		// data embedded as JSON and rendered by the browser
 	std::wstring SimulationReportFile = L"";
 };
 
@@ -97,6 +112,14 @@ struct SimulationInput {
 	bool VisitorDemographics = false;
 
 	std::wstring VisitorDemographicsFile = L"";
+
+	bool ExpandList = false;	// expand an encoded list and exit, no simulation
+
+	std::wstring ExpandListFile = L"";
+
+	bool CompileTemplate = false;	// save the park as a binary image and exit, no simulation
+
+	std::wstring CompileTemplateFile = L"";
 };
 
 
@@ -123,6 +146,7 @@ class Configuration
 
 	void HandleDebugUpdateRate(int);
 	void HandleImportVisitorDemo(const std::wstring);
+	void HandleExpandList(const std::wstring);
 	void HandleReportVisitorDemo(const std::wstring);
 	void HandleSimulationReportHTML(const std::wstring);
 	void HandleTemplateFile(const std::wstring);
@@ -131,6 +155,9 @@ class Configuration
 	void HandleFastPassMode(const std::wstring);
 	void HandleUseConfigFile(std::wstring);
 	void HandleTemperature(const std::wstring);
+	void HandleParkCache(const std::wstring);
+	void HandleCompileTemplate(const std::wstring);
+	void HandleTickSeconds(const std::wstring);
 
 public:
 
@@ -150,6 +177,9 @@ public:
 	ParkTemplate RideTemplate = ParkTemplate::WDWAnimalKingdom;
 	std::wstring RideTemplateFile = L"";
 
+	bool UseParkCache = false;				// keep the data built from the park in ParkCacheFolder between runs
+	std::wstring ParkCacheFolder = L"";
+
 	bool GetVisitorNames = false;
 
 	FastPassType FastPassMode = FastPassType::None;
@@ -160,5 +190,7 @@ public:
 	int ParkCloseTime = 0;  // 24-hour clock
 	int ParkOpenHours = 0;
 
+	int TickSeconds = 60;	// length of an engine step; must divide a minute exactly
+
 	Configuration(int argc, wchar_t* argv[]);
 };
\ No newline at end of file
@@ -27,10 +27,6 @@ namespace Constants
 
 	// ===========================================================================================================================
 
-	const static int MaxRideCount = 30;
-
-	// ===========================================================================================================================
-
 	const static double ArriveAt10 = 10.0;
 	const static double ArriveAt11 = 21.0;
 	const static double ArriveAt12 = 16.1;
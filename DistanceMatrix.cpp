@@ -0,0 +1,101 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include <algorithm>
+#include <cstring>
+
+#include "DistanceMatrix.h"
+
+
+// all values are zeroed
+void DistanceMatrix::Resize(int size)
+{
+	Size = size;
+	Count = 2 * ((size_t)size * (size + 1) / 2);
+
+	size_t bytes = std::max((size_t)1, Count * sizeof(uint16_t));
+
+	bytes = (bytes + kDistanceMatrixAlignment - 1) / kDistanceMatrixAlignment * kDistanceMatrixAlignment;
+
+	Owned.reset(static_cast<uint16_t*>(::operator new(bytes, std::align_val_t(kDistanceMatrixAlignment))));
+
+	memset(Owned.get(), 0, bytes);
+
+	Values = Owned.get();
+}
+
+
+// reads come straight from values (laid out as this class stores them), which must outlive the matrix
+void DistanceMatrix::Share(const uint16_t* values, int size)
+{
+	Owned.reset();
+
+	Size = size;
+	Count = 2 * ((size_t)size * (size + 1) / 2);
+
+	Values = values;
+}
+
+
+// position of the metres value for the pair; minutes follows it
+size_t DistanceMatrix::Index(int from, int to) const
+{
+	size_t low = std::min(from, to);
+	size_t high = std::max(from, to);
+
+	return 2 * (high * (high + 1) / 2 + low);
+}
+
+
+void DistanceMatrix::Set(int from, int to, int metres, int minutes)
+{
+	size_t i = Index(from, to);
+
+	Owned[i]     = static_cast<uint16_t>(std::clamp(metres, 0, 65535));
+	Owned[i + 1] = static_cast<uint16_t>(std::clamp(minutes, 0, 65535));
+}
+
+
+int DistanceMatrix::GetMetres(int from, int to) const
+{
+	return Values[Index(from, to)];
+}
+
+
+int DistanceMatrix::GetMinutes(int from, int to) const
+{
+	return Values[Index(from, to) + 1];
+}
+
+
+int DistanceMatrix::GetSize() const
+{
+	return Size;
+}
+
+
+size_t DistanceMatrix::GetByteCount() const
+{
+	return Count * sizeof(uint16_t);
+}
+
+
+const uint16_t* DistanceMatrix::Data() const
+{
+	return Values;
+}
+
+
+uint16_t* DistanceMatrix::Data()
+{
+	return Owned.get();
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+#include <cstdint>
+#include <memory>
+#include <new>
+
+
+static const size_t kDistanceMatrixAlignment = 64;	// one cache line
+
+
+// walk distance (metres) and walk time (minutes) between every pair of locations, sized to the park.
+// distances are symmetric so only one triangle is stored, packed, with the two values for a pair side
+// by side in one aligned allocation. values are clamped to 65535
+class DistanceMatrix
+{
+	struct AlignedDelete
+	{
+		void operator()(uint16_t* values) const
+		{
+			::operator delete(values, std::align_val_t(kDistanceMatrixAlignment));
+		}
+	};
+
+	int Size = 0;
+	size_t Count = 0;		// values, two per pair
+
+	std::unique_ptr<uint16_t[], AlignedDelete> Owned;
+
+	const uint16_t* Values = nullptr;		// Owned, or a read-only view in to a mapped park image
+
+	size_t Index(int, int) const;
+
+public:
+
+	void Resize(int);
+	void Share(const uint16_t*, int);
+
+	void Set(int, int, int, int);
+
+	int GetMetres(int, int) const;
+	int GetMinutes(int, int) const;
+
+	int GetSize() const;
+
+	// the packed values as they are held in memory, for the park cache file
+	size_t GetByteCount() const;
+	const uint16_t* Data() const;
+	uint16_t* Data();
+};
\ No newline at end of file
@@ -33,6 +33,13 @@ Eatery::Eatery(std::wstring name, int throughput, int x, int y, bool food, bool
 }
 
 
+// the wait time the park gives the eatery, before it's adjusted for the group
+int Eatery::GetWaitTimeSetting()
+{
+	return WaitTime;
+}
+
+
 void Eatery::AddToQueue(int group)
 {
 	Queue.push_back(group);
@@ -48,7 +48,8 @@ public:
 	int X = 0;
 	int Y = 0;
 
-	int Throughput = 0;
+	int Throughput = 0;				// groups per minute
+	int ServedThisMinute = 0;		// groups taken from the queue so far this minute
 
 	Eatery(std::wstring, int, int, int, bool, bool, int, int, int);
 
@@ -56,6 +57,7 @@ public:
 	int RemoveFromQueue();
 
 	int GetWaitTime(GroupType);
+	int GetWaitTimeSetting();
 
 	double QueueWaitTime();
 };
\ No newline at end of file
@@ -0,0 +1,209 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include <algorithm>
+#include <cmath>
+
+#include "EateryIndex.h"
+
+
+namespace
+{
+	// rounds towards -infinity, positions outside the grid can be left of or above it
+	int FloorDiv(int value, int divisor)
+	{
+		int result = value / divisor;
+
+		if ((value % divisor != 0) && (value < 0))
+		{
+			result--;
+		}
+
+		return result;
+	}
+}
+
+
+void EateryIndex::Build(const std::vector<Eatery>& eateries, const std::vector<Ride>& rides)
+{
+	Positions.clear();
+	CellStart.clear();
+	CellEateries.clear();
+	RideCache.clear();
+	RidePositions.clear();
+
+	Columns = 0;
+	Rows = 0;
+
+	if (eateries.size() != 0)
+	{
+		MinX = eateries[0].X;
+		MinY = eateries[0].Y;
+
+		int MaxX = eateries[0].X;
+		int MaxY = eateries[0].Y;
+
+		for (int e = 0; e < eateries.size(); e++)
+		{
+			Positions.push_back({ eateries[e].X, eateries[e].Y });
+
+			MinX = std::min(MinX, eateries[e].X);
+			MinY = std::min(MinY, eateries[e].Y);
+			MaxX = std::max(MaxX, eateries[e].X);
+			MaxY = std::max(MaxY, eateries[e].Y);
+		}
+
+		double area = ((double)MaxX - MinX + 1) * ((double)MaxY - MinY + 1);
+
+		CellSize = std::max(1, static_cast<int>(ceil(sqrt(area / (double)eateries.size()))));
+
+		Columns = (MaxX - MinX) / CellSize + 1;
+		Rows = (MaxY - MinY) / CellSize + 1;
+
+		// counting sort of the eateries by cell, ids stay in ascending order within a cell
+		std::vector<int> cell(eateries.size());
+
+		CellStart.assign((size_t)Columns * Rows + 1, 0);
+
+		for (int e = 0; e < Positions.size(); e++)
+		{
+			cell[e] = ((Positions[e].y - MinY) / CellSize) * Columns + (Positions[e].x - MinX) / CellSize;
+
+			CellStart[cell[e] + 1]++;
+		}
+
+		for (int c = 1; c < CellStart.size(); c++)
+		{
+			CellStart[c] += CellStart[c - 1];
+		}
+
+		std::vector<int> next(CellStart.begin(), CellStart.end() - 1);
+
+		CellEateries.resize(Positions.size());
+
+		for (int e = 0; e < Positions.size(); e++)
+		{
+			CellEateries[next[cell[e]]++] = e;
+		}
+	}
+
+	for (int r = 0; r < rides.size(); r++)
+	{
+		RidePositions.push_back(rides[r].RideOperation.position);
+
+		RideCache.push_back(Search(rides[r].RideOperation.position));
+	}
+}
+
+
+// ride is a hint, the ride the group was last heading to; if they're standing at it the cached answer is used
+NearestEateries EateryIndex::Nearest(QWaitTypes::Coords position, int ride) const
+{
+	if (ride >= 0 && ride < RideCache.size() &&
+		RidePositions[ride].x == position.x && RidePositions[ride].y == position.y)
+	{
+		return RideCache[ride];
+	}
+
+	return Search(position);
+}
+
+
+// keeps the list ordered by distance then id, the same order a scan of every eatery in id order gives
+void EateryIndex::Insert(NearestEateries& nearest, int eatery, int distance) const
+{
+	int slot = nearest.Count;
+
+	while (slot > 0 && (nearest.Distance[slot - 1] > distance || (nearest.Distance[slot - 1] == distance && nearest.Eatery[slot - 1] > eatery)))
+	{
+		slot--;
+	}
+
+	if (slot == kClosestEateryCount)
+	{
+		return;
+	}
+
+	int last = std::min(nearest.Count, kClosestEateryCount - 1);
+
+	for (int s = last; s > slot; s--)
+	{
+		nearest.Eatery[s] = nearest.Eatery[s - 1];
+		nearest.Distance[s] = nearest.Distance[s - 1];
+	}
+
+	nearest.Eatery[slot] = eatery;
+	nearest.Distance[slot] = distance;
+
+	if (nearest.Count < kClosestEateryCount)
+	{
+		nearest.Count++;
+	}
+}
+
+
+NearestEateries EateryIndex::Search(QWaitTypes::Coords position) const
+{
+	NearestEateries nearest;
+
+	if (Columns == 0)
+	{
+		return nearest;
+	}
+
+	int cx = FloorDiv(position.x - MinX, CellSize);
+	int cy = FloorDiv(position.y - MinY, CellSize);
+
+	int max_ring = std::max(std::max(abs(cx), abs(Columns - 1 - cx)), std::max(abs(cy), abs(Rows - 1 - cy)));
+
+	for (int ring = 0; ring <= max_ring; ring++)
+	{
+		// everything in this ring is more than (ring - 1) cells away
+		if (nearest.Count == kClosestEateryCount && nearest.Distance[kClosestEateryCount - 1] < (ring - 1) * CellSize)
+		{
+			break;
+		}
+
+		for (int y = cy - ring; y <= cy + ring; y++)
+		{
+			if (y < 0 || y >= Rows)
+			{
+				continue;
+			}
+
+			// the top and bottom rows of the ring are searched in full, the others only at each end
+			int step = (y == cy - ring || y == cy + ring) ? 1 : std::max(1, 2 * ring);
+
+			for (int x = cx - ring; x <= cx + ring; x += step)
+			{
+				if (x < 0 || x >= Columns)
+				{
+					continue;
+				}
+
+				int c = y * Columns + x;
+
+				for (int i = CellStart[c]; i < CellStart[c + 1]; i++)
+				{
+					int e = CellEateries[i];
+
+					int dx = abs(position.x - Positions[e].x);
+					int dy = abs(position.y - Positions[e].y);
+
+					Insert(nearest, e, static_cast<int>(sqrt((double)dx * dx + dy * dy)));
+				}
+			}
+		}
+	}
+
+	return nearest;
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+#include <vector>
+
+#include "Eatery.h"
+#include "QWaitTypes.h"
+#include "Ride.h"
+
+
+static const int kClosestEateryCount = 5;
+
+
+// the closest eateries to a point, closest first (ties go to the lower eatery id)
+struct NearestEateries {
+	int Count = 0;
+
+	int Eatery[kClosestEateryCount] = { -1, -1, -1, -1, -1 };
+	int Distance[kClosestEateryCount] = { 0, 0, 0, 0, 0 };		// metres
+};
+
+
+// a uniform grid over the eatery positions, sized for roughly one eatery per cell. a query searches
+// outward from its cell one ring at a time and stops once no unsearched cell can hold anything closer
+// than the current nth closest, so its cost depends on the local density rather than the eatery count.
+//
+// idle groups are nearly always standing at a ride, so the answer for every ride's position is worked
+// out once when the index is built
+class EateryIndex
+{
+	int MinX = 0;
+	int MinY = 0;
+
+	int CellSize = 1;			// metres
+	int Columns = 0;
+	int Rows = 0;
+
+	std::vector<int> CellStart;		// Columns x Rows + 1 offsets in to CellEateries
+	std::vector<int> CellEateries;	// eatery ids, grouped by cell
+
+	std::vector<QWaitTypes::Coords> Positions;
+
+	std::vector<NearestEateries> RideCache;
+	std::vector<QWaitTypes::Coords> RidePositions;
+
+	void Insert(NearestEateries&, int, int) const;
+
+	NearestEateries Search(QWaitTypes::Coords) const;
+
+public:
+
+	void Build(const std::vector<Eatery>&, const std::vector<Ride>&);
+
+	NearestEateries Nearest(QWaitTypes::Coords, int) const;
+};
\ No newline at end of file
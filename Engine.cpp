@@ -16,6 +16,7 @@
 #include "Constants.h"
 #include "Engine.h"
 #include "ParkController.h"
+#include "Profiler.h"
 #include "ReportUtility.h"
 #include "Utility.h"
 #include "VisitorController.h"
@@ -25,7 +26,7 @@ extern ParkController* GParkController;
 extern VisitorController* GVisitorController;
 
 
-Engine::Engine(FastPassType fast_pass, int park_open_time, int park_close_time, bool show_output, int update_rate, bool handle_food_drink, int temp)
+Engine::Engine(FastPassType fast_pass, int park_open_time, int park_close_time, bool show_output, int update_rate, bool handle_food_drink, int temp, int tick_seconds)
 {
 	UpdateRate = update_rate;
 
@@ -39,11 +40,19 @@ Engine::Engine(FastPassType fast_pass, int park_open_time, int park_close_time,
 
 	GParkController->FastPassMode = FastPassMode;
 
-	CurrentTime.hours = park_open_time;
-	CurrentTime.minutes = 0;
+	CurrentTime = QWaitTypes::MakeTime(park_open_time, 0);
 
-	TimeRidesClose = park_close_time;
-	TimeParkCloses = park_close_time + 1;
+	TimeRidesClose = QWaitTypes::MakeTime(park_close_time, 0);
+	TimeParkCloses = QWaitTypes::MakeTime(park_close_time + 1, 0);
+
+	TicksPerMinute = 60 / tick_seconds;
+
+	GVisitorController->HotState.TicksPerMinute = TicksPerMinute;
+
+	for (int r = 0; r < GParkController->Rides.size(); r++)
+	{
+		GParkController->Rides[r].SetTicksPerMinute(TicksPerMinute);
+	}
 
 	VisitorsInPark = 0;
 
@@ -64,31 +73,113 @@ void Engine::Run(bool report_mxm, bool report_visitor_location)
 {
 	if (FastPassMode != FastPassType::None)
 	{
+		ProfileScope<true> timer(ProfileSection::PreArrivalFastPass);
+
 		PreArrivalFastPass();
 	}
 
+	if (HandleFoodDrink)
+	{
+		GVisitorController->HotState.StartConsumption(Temperature);
+	}
+
 	OutputStatus(L"Park open!                                                " + ReportUtility::BarGraphScale());
 
-	while (CurrentTime.hours != TimeParkCloses)
+	int features = 0;
+
+	if (HandleFoodDrink)
+	{
+		features |= kFeatureFoodDrink;
+	}
+
+	if (FastPassMode != FastPassType::None)
+	{
+		features |= kFeatureFastPass;
+	}
+
+	if (report_mxm)
+	{
+		features |= kFeatureMinuteStats;
+	}
+
+	if (report_visitor_location)
+	{
+		features |= kFeatureVisitorLocation;
+	}
+
+	if (GProfiler->Enabled)
+	{
+		features |= kFeatureProfile;
+	}
+
 	{
+		ProfileScope<true> timer(ProfileSection::Day);
+
+		Dispatch(features, std::make_integer_sequence<int, kEngineFeatureCombinations>());
+	}
+
+	GParkController->Minutes--;
+
+	for (int g = 0; g < GVisitorController->Groups.size(); g++)
+	{
+		GVisitorController->Groups[g].FlushStatusMinutes();
+	}
+
+	OutputStatus(L"\nPark closed!");
+}
+
+
+// runs the day with the RunDay instantiation matching features
+template <int... Flags>
+void Engine::Dispatch(int features, std::integer_sequence<int, Flags...>)
+{
+	((features == Flags ? RunDay<EngineFeatures<Flags>>() : void()), ...);
+}
+
+
+template <typename Features>
+void Engine::RunDay()
+{
+	while (CurrentTime != TimeParkCloses)
+	{
+		// everything that's recorded once a minute is recorded on the minute's last tick
+		const bool minute_ends = CurrentTick == TicksPerMinute - 1;
+
+		if (CurrentTick == 0)
+		{
+			StartMinute();
+		}
+
 		// ========================================================================================================
 		// == Visitor Processing ==================================================================================
 		// ========================================================================================================
 
+		// countdowns and time spent for every group at once; only the groups with something to decide
+		// are handed to the code below (see GroupHotState)
+		{
+			ProfileScope<Features::Profile> timer(ProfileSection::GroupCountdowns);
+
+			GVisitorController->HotState.Advance(CurrentTime, ParkOpen);
+		}
+
 		for (int g = 0; g < GVisitorController->Groups.size(); g++)
 		{
-			switch (GVisitorController->Groups[g].Behaviour.parkStatus)
+			if (GVisitorController->HotState.Ready[g] == 0)
+			{
+				continue;
+			}
+
+			ProfileScope<Features::Profile> timer(GVisitorController->Groups[g].GetParkStatus());
+
+			switch (GVisitorController->Groups[g].GetParkStatus())
 			{
-				// let's see if the visitor should enter the park
+				// the group has arrived at the park
 			case GroupParkStatus::OnWay:
 
-				if (Utility::IsTimeEqual(CurrentTime, GVisitorController->Groups[g].Configuration.arrivalTime))
-				{
-					GVisitorController->Groups[g].SetStatusForAllVisitors(GroupParkStatus::AtEntrance, VisitorParkStatus::AtEntrance);
+				GVisitorController->Groups[g].SetStatusForAllVisitors(GroupParkStatus::AtEntrance, VisitorParkStatus::AtEntrance);
 
-					GVisitorController->Groups[g].UpdateLocation(GParkController->entrance.position.x,
-						                                        GParkController->entrance.position.y);
-				}
+				GVisitorController->Groups[g].UpdateLocation(GParkController->entrance.position.x,
+					                                        GParkController->entrance.position.y);
 
 				break;
 
@@ -100,26 +191,13 @@ void Engine::Run(bool report_mxm, bool report_visitor_location)
 
 			case GroupParkStatus::Idle:
 
-				ParkStatusIdle(g);
+				ParkStatusIdle<Features>(g);
 
 				break;
 
 			case GroupParkStatus::Riding:
 
-				ParkStatusRiding(g);
-
-				break;
-
-			case GroupParkStatus::Queuing:
-			case GroupParkStatus::QueuingFastPass:
-
-				GVisitorController->Groups[g].SetStatForAllVisitors(GroupVisitorStat::TimeSpentQueuing);
-
-				break;
-
-			case GroupParkStatus::QueuingFood:
-
-				GVisitorController->Groups[g].SetStatForAllVisitors(GroupVisitorStat::TimeSpentQueuingFood);
+				ParkStatusRiding<Features>(g);
 
 				break;
 
@@ -146,25 +224,32 @@ void Engine::Run(bool report_mxm, bool report_visitor_location)
 				ParkStatusEating(g);
 
 				break;
-
-			case GroupParkStatus::Exited:
-				break;
 			}
+		}
 
-			if (report_visitor_location)
+		if constexpr (Features::VisitorLocation)
+		{
+			if (minute_ends)
 			{
-				GVisitorController->Groups[g].SaveMinuteStats();
+				ProfileScope<Features::Profile> timer(ProfileSection::VisitorLocation);
+
+				// travelling groups' positions are evaluated here, and only here
+				for (int g = 0; g < GVisitorController->Groups.size(); g++)
+				{
+					GVisitorController->Groups[g].SaveMinuteStats();
+				}
 			}
+		}
 
-			// ========================================================================================================
-			// == Food and Drink ======================================================================================
-			// ========================================================================================================
+		// ========================================================================================================
+		// == Food and Drink ======================================================================================
+		// ========================================================================================================
 
-			if (HandleFoodDrink)
+		if constexpr (Features::FoodDrink)
+		{
+			if (minute_ends)
 			{
-				GVisitorController->Groups[g].UpdateConsumption(Temperature);
-
-				GVisitorController->Groups[g].Behaviour.consumption.TimeSinceDrink++;
+				GVisitorController->HotState.ConsumptionMinute++;	// drink levels are worked out when needed (see GroupHotState)
 			}
 		}
 
@@ -174,6 +259,8 @@ void Engine::Run(bool report_mxm, bool report_visitor_location)
 
 		if (GParkController->EntranceQueueSize() != 0)
 		{
+			ProfileScope<Features::Profile> timer(ProfileSection::Entrance);
+
 			EntranceProcessQueue();
 		}
 
@@ -181,16 +268,15 @@ void Engine::Run(bool report_mxm, bool report_visitor_location)
 		// == Ride Processing =====================================================================================
 		// ========================================================================================================
 
-		for (int r = 0; r < GParkController->Rides.size(); r++)
 		{
-			if (!GParkController->Rides[r].RideOperation.isShutdown)
-			{
-				ProcessRide(r);
-			}
+			ProfileScope<Features::Profile> timer(ProfileSection::Rides);
 
-			if (report_mxm)
+			for (int r = 0; r < GParkController->Rides.size(); r++)
 			{
-				GParkController->Rides[r].UpdateMinuteStats();
+				if (!GParkController->Rides[r].RideOperation.isShutdown)
+				{
+					ProcessRide(r);
+				}
 			}
 		}
 
@@ -198,8 +284,10 @@ void Engine::Run(bool report_mxm, bool report_visitor_location)
 		// == Food Drink Processing ===============================================================================
 		// ========================================================================================================
 
-		if (HandleFoodDrink)
+		if constexpr (Features::FoodDrink)
 		{
+			ProfileScope<Features::Profile> timer(ProfileSection::Eateries);
+
 			for (int e = 0; e < GParkController->Eateries.size(); e++)
 			{
 				EateryProcessQueue(e);
@@ -208,48 +296,97 @@ void Engine::Run(bool report_mxm, bool report_visitor_location)
 
 		// ========================================================================================================
 
-		if (report_mxm)
+		if constexpr (Features::MinuteStats)
 		{
-			GVisitorController->UpdateMinuteStats(Utility::FormatTime(CurrentTime.hours, CurrentTime.minutes));
+			if (minute_ends)
+			{
+				ProfileScope<Features::Profile> timer(ProfileSection::MinuteStats);
+
+				// eatery processing doesn't touch the rides, so their stats can be taken here with the visitors'
+				for (int r = 0; r < GParkController->Rides.size(); r++)
+				{
+					GParkController->Rides[r].UpdateMinuteStats();
+				}
+
+				GVisitorController->UpdateMinuteStats(CurrentTime);
+			}
 		}
 
 		// ========================================================================================================
 
-		GParkController->Minutes++;
+		if (minute_ends)
+		{
+			GParkController->Minutes++;
+		}
 
 		// ========================================================================================================
 
 		UpdateClock();
 	}
+}
 
-	GParkController->Minutes--;
 
-	OutputStatus(L"\nPark closed!");
+// the entrance, rides and eateries have a capacity per minute, released over the minute's ticks
+void Engine::StartMinute()
+{
+	EntranceAdmitted = 0;
+
+	for (int r = 0; r < GParkController->Rides.size(); r++)
+	{
+		GParkController->Rides[r].LoadedThisMinute = 0;
+		GParkController->Rides[r].LoadedThisMinuteFastPass = 0;
+	}
+
+	for (int e = 0; e < GParkController->Eateries.size(); e++)
+	{
+		GParkController->Eateries[e].ServedThisMinute = 0;
+	}
 }
 
 
 void Engine::UpdateClock()
 {
-	if (CurrentTime.minutes % UpdateRate == 0)
+	DayTick++;
+	CurrentTick++;
+
+	if (CurrentTick != TicksPerMinute)
 	{
-		ShowLiveStats();
+		return;
 	}
 
-	CurrentTime.minutes++;
+	CurrentTick = 0;
 
-	if (CurrentTime.minutes == 60)
+	if (QWaitTypes::Minute(CurrentTime) % UpdateRate == 0)
 	{
-		CurrentTime.minutes = 0;
-		CurrentTime.hours++;
+		ShowLiveStats();
+	}
 
-		if (CurrentTime.hours == TimeRidesClose)
-		{
-			ParkOpen = false;
-		}
+	CurrentTime++;
+
+	if (CurrentTime == TimeRidesClose)
+	{
+		ParkOpen = false;
 	}
 }
 
 
+// the part of a per-minute capacity available by the end of the current tick
+int Engine::ReleasedThisMinute(int per_minute)
+{
+	return per_minute * (CurrentTick + 1) / TicksPerMinute;
+}
+
+
+// a queue is served while some of the minute's capacity is left. one that nothing has left this minute
+// still gets a try on the last tick, as it did when the engine stepped a whole minute at a time (that's
+// how groups bigger than a ride's per-minute capacity get on)
+bool Engine::CanProcess(int processed, int released)
+{
+	return processed < released || (processed == 0 && CurrentTick == TicksPerMinute - 1);
+}
+
+
+template <typename Features>
 QWaitTypes::GetRide Engine::GetRide(int group)
 {
 	int SelectedRide = Constants::kNoSelectedRide;
@@ -267,7 +404,7 @@ QWaitTypes::GetRide Engine::GetRide(int group)
 		{
 			int isbetteravailable = IsRideAvailableCloser(group, SelectedRide);
 
-			QWaitTypes::FastPass FastPassDetails = IsFastPassTicketSoon(group, SelectedRide);
+			QWaitTypes::FastPass FastPassDetails = IsFastPassTicketSoon<Features>(group, SelectedRide);
 
 			if (isbetteravailable != Constants::kNoSelectedRide && FastPassDetails.ride == Constants::kNoSelectedRide)
 			{
@@ -275,7 +412,7 @@ QWaitTypes::GetRide Engine::GetRide(int group)
 			}
 			else if (FastPassDetails.ride != Constants::kNoSelectedRide)
 			{
-				return { FastPassDetails.ride, FastPassDetails.ticket.hours };
+				return { FastPassDetails.ride, QWaitTypes::Hour(FastPassDetails.ticket) };
 			}
 
 			return { SelectedRide, kNoSelectedFastPassTicket };
@@ -330,9 +467,10 @@ int Engine::IsRideAvailableCloser(int group, int possible_destination)
 // =================================================================================================================
 
 
+template <typename Features>
 QWaitTypes::FastPass Engine::IsFastPassTicketSoon(int group, int possible_destination)
 {
-	if (FastPassMode != FastPassType::None)
+	if constexpr (Features::FastPass)
 	{
 		if (GVisitorController->Groups[group].FastPassTickets.size() != 0)
 		{
@@ -340,7 +478,7 @@ QWaitTypes::FastPass Engine::IsFastPassTicketSoon(int group, int possible_destin
 												GParkController->GetDistanceBetweenInMinutes(GVisitorController->Groups[group].Behaviour.currentRide, possible_destination) +
 												GParkController->GetDistanceBetweenInMinutes(possible_destination, GVisitorController->Groups[group].FastPassTickets[0].ride);
 
-			int TimeToFPT = Utility::Duration(CurrentTime, GVisitorController->Groups[group].FastPassTickets[0].ticket);
+			int TimeToFPT = GVisitorController->Groups[group].FastPassTickets[0].ticket - CurrentTime;
 
 			// fastpass slot is 1 hour
 			if (TimeRequired < TimeToFPT + 59)
@@ -354,7 +492,7 @@ QWaitTypes::FastPass Engine::IsFastPassTicketSoon(int group, int possible_destin
 		}
 	}
 
-	return { Constants::kNoSelectedType, Constants::kNoSelectedRide, { 0, 0 } };
+	return { Constants::kNoSelectedType, Constants::kNoSelectedRide, 0 };
 }
 
 
@@ -458,9 +596,9 @@ QWaitTypes::FastPass Engine::GetFastPassRide(int type, QWaitTypes::Time arrive,
 
 			if (ticket != kNoSelectedFastPassTicket)
 			{
-				if (Utility::IsTicketValidForTime(arrive, leave, { ticket, 0 }))
+				if (Utility::IsTicketValidForTime(arrive, leave, QWaitTypes::MakeTime(ticket, 0)))
 				{
-					return { type, ride, { GParkController->Rides[ride].GetFastPassTicket(arrive, leave), 0 } };
+					return { type, ride, QWaitTypes::MakeTime(GParkController->Rides[ride].GetFastPassTicket(arrive, leave), 0) };
 				}
 
 				ticket = kNoSelectedFastPassTicket;
@@ -471,7 +609,7 @@ QWaitTypes::FastPass Engine::GetFastPassRide(int type, QWaitTypes::Time arrive,
 		} while (fpt < GParkController->FastPassTypes[type - 1].size() && ticket == kNoSelectedFastPassTicket);
 	}
 
-	return { Constants::kNoSelectedType, Constants::kNoSelectedRide, { 0, 0 } };
+	return { Constants::kNoSelectedType, Constants::kNoSelectedRide, 0 };
 }
 
 
@@ -523,7 +661,13 @@ void Engine::GetReplacementFastPassRide(int group)
 
 void Engine::EntranceProcessQueue()
 {
-	int count = 0;
+	int released = ReleasedThisMinute(GParkController->entrance.throughPutMinute);
+
+	if (!CanProcess(EntranceAdmitted, released))
+	{
+		return;
+	}
+
 	int GroupID = Constants::kNotValidGroup;
 
 	do
@@ -538,11 +682,11 @@ void Engine::EntranceProcessQueue()
 			{
 				GVisitorController->Groups[GroupID].Visitors[v].BuyItem(GParkController->BuyTicket(GVisitorController->Groups[GroupID].Visitors[v].Configuration.Age, false));
 			}
-		}
 
-		count++;
+			EntranceAdmitted++;
+		}
 
-	} while (count < GParkController->entrance.throughPutMinute && GroupID != Constants::kNotValidGroup);
+	} while (EntranceAdmitted < released && GroupID != Constants::kNotValidGroup);
 }
 
 
@@ -550,7 +694,7 @@ void Engine::ProcessRide(int ride)
 {
 	if (GParkController->Rides[ride].RideOperation.isOpen)
 	{
-		if (Utility::IsTimeEqual(CurrentTime, GParkController->Rides[ride].RideOperation.close))
+		if (CurrentTime == GParkController->Rides[ride].RideOperation.close)
 		{
 			RideEmptyQueue(ride);
 
@@ -561,7 +705,7 @@ void Engine::ProcessRide(int ride)
 	}
 	else
 	{
-		if (Utility::IsTimeEqual(CurrentTime, GParkController->Rides[ride].RideOperation.open))
+		if (CurrentTime == GParkController->Rides[ride].RideOperation.open)
 		{
 			GParkController->Rides[ride].RideOperation.isOpen = true;
 		}
@@ -580,7 +724,8 @@ void Engine::ProcessRide(int ride)
 	}
 	case RideType::Show:
 	{
-		if ((GParkController->Rides[ride].QueueSize() != 0 || GParkController->Rides[ride].QueueSizeFastPass() != 0) && CurrentTime.minutes % GParkController->Rides[ride].RideOperation.ShowStartTime == 0)
+		// shows start on the minute
+		if (CurrentTick == 0 && (GParkController->Rides[ride].QueueSize() != 0 || GParkController->Rides[ride].QueueSizeFastPass() != 0) && QWaitTypes::Minute(CurrentTime) % GParkController->Rides[ride].RideOperation.ShowStartTime == 0)
 		{
 			RideShowProcessQueue(ride);
 		}
@@ -593,19 +738,23 @@ void Engine::ProcessRide(int ride)
 }
 
 
+// the ride's per-minute capacity is released a tick at a time (see Ride::CapacityToTick), so the
+// minutes' total over an hour matches the ride's hourly throughput
 void Engine::RideContinuousProcessQueue(int ride)
 {
-	int count = 0;
+	int count = GParkController->Rides[ride].LoadedThisMinuteFastPass;
 	QWaitTypes::Riders Visitor;
 
-	if (GParkController->Rides[ride].FastPass.mode != 0)
+	int released_fast_pass = GParkController->Rides[ride].CapacityToTick(DayTick, CurrentTick, true);
+
+	if (GParkController->Rides[ride].FastPass.mode != 0 && CanProcess(count, released_fast_pass))
 	{
 		do
 		{
 			Visitor = GParkController->Rides[ride].NextItemInQueueFastPass();
 			   
 			// if this group is larger than the maximum throughput per minute then we have to let them all through
-			if (Visitor.group != Constants::kNotValidGroup && (Visitor.memberID.size() <= (GParkController->Rides[ride].RideThroughput.perMinuteIFastPass - count) || Visitor.memberID.size() > GParkController->Rides[ride].RideThroughput.perMinuteIFastPass))
+			if (Visitor.group != Constants::kNotValidGroup && (static_cast<int>(Visitor.memberID.size()) <= (released_fast_pass - count) || static_cast<int>(Visitor.memberID.size()) > GParkController->Rides[ride].RideThroughput.perMinuteIFastPass))
 			{			
 				GParkController->Rides[ride].RemoveFromQueueFastPass();
 
@@ -621,7 +770,19 @@ void Engine::RideContinuousProcessQueue(int ride)
 				Visitor.group = Constants::kNotValidGroup;
 			}
 
-		} while (count < GParkController->Rides[ride].RideThroughput.perMinuteIFastPass && Visitor.group != Constants::kNotValidGroup);
+		} while (count < released_fast_pass && Visitor.group != Constants::kNotValidGroup);
+	}
+
+	GParkController->Rides[ride].LoadedThisMinuteFastPass = count;
+
+	// standard riders can use any fastpass capacity that wasn't needed
+	int released = GParkController->Rides[ride].CapacityToTick(DayTick, CurrentTick, false) + released_fast_pass;
+
+	count += GParkController->Rides[ride].LoadedThisMinute;
+
+	if (count >= released && !(GParkController->Rides[ride].LoadedThisMinute == 0 && CurrentTick == TicksPerMinute - 1))
+	{
+		return;
 	}
 
 	do
@@ -629,7 +790,7 @@ void Engine::RideContinuousProcessQueue(int ride)
 		Visitor = GParkController->Rides[ride].NextItemInQueue();
 
 		// if this group is larger than the maximum throughput per minute then we have to let them all through
-		if (Visitor.group != Constants::kNotValidGroup && (static_cast<int>(Visitor.memberID.size()) <= (GParkController->Rides[ride].RideThroughput.perMinuteI + GParkController->Rides[ride].RideThroughput.perMinuteIFastPass - count) || static_cast<int>(Visitor.memberID.size()) > GParkController->Rides[ride].RideThroughput.perMinuteI))
+		if (Visitor.group != Constants::kNotValidGroup && (static_cast<int>(Visitor.memberID.size()) <= (released - count) || static_cast<int>(Visitor.memberID.size()) > GParkController->Rides[ride].RideThroughput.perMinuteI))
 		{
 			GParkController->Rides[ride].RemoveFromQueue();
 
@@ -639,13 +800,15 @@ void Engine::RideContinuousProcessQueue(int ride)
 			GParkController->Rides[ride].CurrentRiders += Visitor.memberID.size();
 
 			count += Visitor.memberID.size();
+
+			GParkController->Rides[ride].LoadedThisMinute += Visitor.memberID.size();
 		}
 		else
 		{
 			Visitor.group = Constants::kNotValidGroup;
 		}
 
-	} while (count < GParkController->Rides[ride].RideThroughput.perMinuteI + GParkController->Rides[ride].RideThroughput.perMinuteIFastPass && Visitor.group != Constants::kNotValidGroup);
+	} while (count < released && Visitor.group != Constants::kNotValidGroup);
 }
 
 
@@ -738,7 +901,12 @@ void Engine::EateryProcessQueue(int eatery)
 {
 	if (GParkController->Eateries[eatery].Queue.size() != 0)
 	{
-		auto count = 0;
+		int released = ReleasedThisMinute(GParkController->Eateries[eatery].Throughput);
+
+		if (!CanProcess(GParkController->Eateries[eatery].ServedThisMinute, released))
+		{
+			return;
+		}
 
 		int group;
 
@@ -750,17 +918,17 @@ void Engine::EateryProcessQueue(int eatery)
 			{
 				GVisitorController->Groups[group].SetStatusForAllVisitors(GroupParkStatus::Eating, VisitorParkStatus::Eating);
 
-				GVisitorController->Groups[group].Behaviour.waitingTime += GParkController->Eateries[eatery].GetWaitTime(GVisitorController->Groups[group].Configuration.type);
+				GVisitorController->HotState.WaitingTime[group] += GParkController->Eateries[eatery].GetWaitTime(GVisitorController->Groups[group].Configuration.type) * TicksPerMinute;
 
 				GParkController->Eateries[eatery].Statistics.Customers += GVisitorController->Groups[group].Visitors.size();
 
 				GParkController->Eateries[eatery].Statistics.Spend += (GVisitorController->Groups[group].AdultCount * GParkController->Eateries[eatery].AveragePriceAdult) +
 																	  (GVisitorController->Groups[group].ChildCount * GParkController->Eateries[eatery].AveragePriceChild);
 
-				count++;
+				GParkController->Eateries[eatery].ServedThisMinute++;
 			}
 
-		} while (count < GParkController->Eateries[eatery].Throughput && group != Constants::kNotValidGroup);
+		} while (GParkController->Eateries[eatery].ServedThisMinute < released && group != Constants::kNotValidGroup);
 	}
 }
 
@@ -800,10 +968,10 @@ void Engine::ParkStatusEntrance(int group)
 }
 
 
+template <typename Features>
 void Engine::ParkStatusIdle(int group)
 {
-	if ((CurrentTime.minutes >= GVisitorController->Groups[group].Configuration.departureTime.minutes && CurrentTime.hours == GVisitorController->Groups[group].Configuration.departureTime.hours)
-		|| !ParkOpen)
+	if (GVisitorController->HotState.IsDeparting(group, CurrentTime) || !ParkOpen)
 	{
 		GVisitorController->Groups[group].UpdateLocation(Constants::kLocationExitedPark, Constants::kLocationExitedPark);
 
@@ -813,16 +981,17 @@ void Engine::ParkStatusIdle(int group)
 	{
 		bool FindRide = true;
 
-		if (HandleFoodDrink)
+		if constexpr (Features::FoodDrink)
 		{
-			if (GVisitorController->Groups[group].Behaviour.consumption.Drink > GVisitorController->Groups[group].Behaviour.consumption.Threshold)
+			if (GVisitorController->HotState.GetDrink(group) > GVisitorController->Groups[group].Behaviour.consumption.Threshold)
 			{
-				QWaitTypes::GetEatery eatery = GParkController->GetClosestEatery(GVisitorController->Groups[group].Behaviour.location, GVisitorController->Groups[group].GetMaximumWaitingTimeFood());
+				QWaitTypes::GetEatery eatery = GParkController->GetClosestEatery(GVisitorController->Groups[group].GetLocation(), GVisitorController->Groups[group].GetMaximumWaitingTimeFood(),
+					GVisitorController->Groups[group].Behaviour.travelling.toRide);
 
 				if (eatery.eatery != -1)
 				{
 					GVisitorController->Groups[group].SetNewEatery(eatery.eatery,
-						static_cast<int>((double)eatery.distance / (double)Constants::WalkSpeedMetresPerMinute),
+						static_cast<int>((double)eatery.distance * TicksPerMinute / (double)Constants::WalkSpeedMetresPerMinute),
 						eatery.distance,
 						eatery.location);
 
@@ -838,12 +1007,12 @@ void Engine::ParkStatusIdle(int group)
 		if (FindRide)
 		{
 			// lets find something to ride
-			QWaitTypes::GetRide NewRide = GetRide(group);
+			QWaitTypes::GetRide NewRide = GetRide<Features>(group);
 
 			if (NewRide.ride != Constants::kNoSelectedRide)
 			{
 				GVisitorController->Groups[group].SetNewRide(NewRide.ride, NewRide.fastPassTicket,
-					GParkController->GetDistanceBetweenInMinutes(GVisitorController->Groups[group].Behaviour.currentRide, NewRide.ride),
+					GParkController->GetDistanceBetweenInTicks(GVisitorController->Groups[group].Behaviour.currentRide, NewRide.ride, TicksPerMinute),
 					GParkController->GetDistanceBetweenInMetres(GVisitorController->Groups[group].Behaviour.currentRide, NewRide.ride),
 					GParkController->Rides[NewRide.ride].RideOperation.position);
 			}
@@ -852,126 +1021,115 @@ void Engine::ParkStatusIdle(int group)
 				GVisitorController->Groups[group].SetStatForAllVisitors(GroupVisitorStat::NoRideAvailable);
 
 				GVisitorController->Groups[group].SetStatForAllVisitors(GroupVisitorStat::TimeSpentIdle);
+
+				// nothing will have changed enough to be worth looking again until the next minute
+				GVisitorController->HotState.WaitingTime[group] = TicksPerMinute - 1 - CurrentTick;
 			}
 		}
 	}
 }
 
 
+// the ride has finished
+template <typename Features>
 void Engine::ParkStatusRiding(int group)
 {
-	if (GVisitorController->Groups[group].Riding.timeLeft == 0)
-	{
-		int ridercount = GVisitorController->Groups[group].GroupRemovedFromRide(GVisitorController->Groups[group].Behaviour.currentRide, GParkController->Rides[GVisitorController->Groups[group].Behaviour.currentRide].RideOperation.rideExitType);
+	int ridercount = GVisitorController->Groups[group].GroupRemovedFromRide(GVisitorController->Groups[group].Behaviour.currentRide, GParkController->Rides[GVisitorController->Groups[group].Behaviour.currentRide].RideOperation.rideExitType);
 
-		GParkController->Rides[GVisitorController->Groups[group].Behaviour.currentRide].CurrentRiders -= ridercount;
+	GParkController->Rides[GVisitorController->Groups[group].Behaviour.currentRide].CurrentRiders -= ridercount;
 
-		// fastpass stuff
-		if (FastPassMode != FastPassType::None && GVisitorController-> Groups[group].FastPassTickets.size() == 0)
+	// fastpass stuff
+	if constexpr (Features::FastPass)
+	{
+		if (GVisitorController->Groups[group].FastPassTickets.size() == 0)
 		{
 			GetReplacementFastPassRide(group);
 
 			GVisitorController->Groups[group].SetWaiting(5); // indicates time taken to get/check fastpass tickets
 		}
 	}
-	else
-	{
-		GVisitorController->Groups[group].Riding.timeLeft--;
-
-		GVisitorController->Groups[group].SetStatForAllVisitors(GroupVisitorStat::TimeSpentRiding);
-	}
 }
 
 
+// the group has reached the ride
 void Engine::ParkStatusTravellingRide(int group)
 {
-	if (GVisitorController->Groups[group].Behaviour.travelling.minutesLeft == 0)
+	GVisitorController->Groups[group].UpdateLocation(GParkController->Rides[GVisitorController->Groups[group].Behaviour.travelling.toRide].RideOperation.position.x,
+		                                             GParkController->Rides[GVisitorController->Groups[group].Behaviour.travelling.toRide].RideOperation.position.y);
+
+	if (ParkOpen)
 	{
-		GVisitorController->Groups[group].UpdateLocation(GParkController->Rides[GVisitorController->Groups[group].Behaviour.travelling.toRide].RideOperation.position.x,
-			                                             GParkController->Rides[GVisitorController->Groups[group].Behaviour.travelling.toRide].RideOperation.position.y);
+		int Ride = GVisitorController->Groups[group].Behaviour.travelling.toRide;
 
-		if (ParkOpen)
+		// if they travel there and find the queue has changed then they are willing to wait a bit longer
+		if (GParkController->Rides[Ride].WaitTime(GVisitorController->Groups[group].Behaviour.travelling.fastPass) < (double)GVisitorController->Groups[group].Behaviour.maximumRideWaitingTime * 1.10)
 		{
-			int Ride = GVisitorController->Groups[group].Behaviour.travelling.toRide;
-
-			// if they travel there and find the queue has changed then they are willing to wait a bit longer
-			if (GParkController->Rides[Ride].WaitTime(GVisitorController->Groups[group].Behaviour.travelling.fastPass) < (double)GVisitorController->Groups[group].Behaviour.maximumRideWaitingTime * 1.10)
-			{
-				QWaitTypes::Riders riders;
+			QWaitTypes::Riders riders;
 
-				riders.group = group;
+			riders.group = group;
 
-				for (int v = 0; v < GVisitorController->Groups[group].Visitors.size(); v++)
+			for (int v = 0; v < GVisitorController->Groups[group].Visitors.size(); v++)
+			{
+				if (GVisitorController->Groups[group].IsRideSuitable(v, GParkController->Rides[Ride].RideOperation.ChildValid, GParkController->Rides[Ride].RideOperation.AdultValid)) // to do fail here?!
 				{
-					if (GVisitorController->Groups[group].IsRideSuitable(v, GParkController->Rides[Ride].RideOperation.ChildValid, GParkController->Rides[Ride].RideOperation.AdultValid)) // to do fail here?!
+					riders.memberID.push_back(v);
+
+					if (GVisitorController->Groups[group].Behaviour.travelling.fastPass != Constants::kNoFastPass)
 					{
-						riders.memberID.push_back(v);
-
-						if (GVisitorController->Groups[group].Behaviour.travelling.fastPass != Constants::kNoFastPass)
-						{
-							GVisitorController->Groups[group].Visitors[v].SetQueuingFastPassLengthStat(GParkController->Rides[Ride].WaitTime(GVisitorController->Groups[group].Behaviour.travelling.fastPass));
-						}
-						else
-						{
-							GVisitorController->Groups[group].Visitors[v].SetQueuingLengthStat(GParkController->Rides[Ride].WaitTime(GVisitorController->Groups[group].Behaviour.travelling.fastPass));
-						}
+						GVisitorController->Groups[group].Visitors[v].SetQueuingFastPassLengthStat(GParkController->Rides[Ride].WaitTime(GVisitorController->Groups[group].Behaviour.travelling.fastPass));
 					}
 					else
 					{
-						GVisitorController->Groups[group].Visitors[v].Rides.rideNotSuitableForMe++;
+						GVisitorController->Groups[group].Visitors[v].SetQueuingLengthStat(GParkController->Rides[Ride].WaitTime(GVisitorController->Groups[group].Behaviour.travelling.fastPass));
 					}
 				}
-
-				if (riders.memberID.size() != 0)
+				else
 				{
-					if (GVisitorController->Groups[group].Behaviour.travelling.fastPass != Constants::kNoFastPass)
-					{
-						GParkController->Rides[Ride].AddToQueueFastPass(riders);
+					GVisitorController->Groups[group].Visitors[v].Rides.rideNotSuitableForMe++;
+				}
+			}
 
-						GVisitorController->Groups[group].SetAtRideQueuingFastPass(Ride);
-					}
-					else
-					{
-						GParkController->Rides[Ride].AddToQueue(riders);
+			if (riders.memberID.size() != 0)
+			{
+				if (GVisitorController->Groups[group].Behaviour.travelling.fastPass != Constants::kNoFastPass)
+				{
+					GParkController->Rides[Ride].AddToQueueFastPass(riders);
 
-						GVisitorController->Groups[group].SetAtRideQueuing(Ride);
-					}
+					GVisitorController->Groups[group].SetAtRideQueuingFastPass(Ride);
 				}
 				else
 				{
-					GVisitorController->Groups[group].SetStatusForAllVisitors(GroupParkStatus::Idle, VisitorParkStatus::Idle);
+					GParkController->Rides[Ride].AddToQueue(riders);
 
-					GVisitorController->Groups[group].SetStatForAllVisitors(GroupVisitorStat::NooneCanRideInGroup);
+					GVisitorController->Groups[group].SetAtRideQueuing(Ride);
 				}
 			}
 			else
-			{			
-				// queue is much bigger than expected or tolerated, so let's go looking for something else
+			{
 				GVisitorController->Groups[group].SetStatusForAllVisitors(GroupParkStatus::Idle, VisitorParkStatus::Idle);
 
-				GVisitorController->Groups[group].SetStatForAllVisitors(GroupVisitorStat::WaitTimeTooLong);
+				GVisitorController->Groups[group].SetStatForAllVisitors(GroupVisitorStat::NooneCanRideInGroup);
 			}
 		}
 		else
-		{
-			GVisitorController->Groups[group].UpdateLocation(Constants::kLocationExitedPark, Constants::kLocationExitedPark);
+		{			
+			// queue is much bigger than expected or tolerated, so let's go looking for something else
+			GVisitorController->Groups[group].SetStatusForAllVisitors(GroupParkStatus::Idle, VisitorParkStatus::Idle);
+
+			GVisitorController->Groups[group].SetStatForAllVisitors(GroupVisitorStat::WaitTimeTooLong);
 		}
 	}
 	else
-	{	
-		GVisitorController->Groups[group].Behaviour.travelling.minutesLeft--;
-
-		GVisitorController->Groups[group].SetStatForAllVisitors(GroupVisitorStat::TimeSpentTravelling);		
-
-		GVisitorController->Groups[group].UpdateTravellingLocation();
+	{
+		GVisitorController->Groups[group].UpdateLocation(Constants::kLocationExitedPark, Constants::kLocationExitedPark);
 	}
 }
 
 
+// the group is due to leave, or has finished waiting
 void Engine::ParkStatusWaiting(int group)
 {
-	if ((CurrentTime.minutes >= GVisitorController->Groups[group].Configuration.departureTime.minutes && CurrentTime.hours == GVisitorController->Groups[group].Configuration.departureTime.hours)
-		|| !ParkOpen)
+	if (GVisitorController->HotState.IsDeparting(group, CurrentTime) || !ParkOpen)
 	{
 		GVisitorController->Groups[group].UpdateLocation(Constants::kLocationExitedPark, Constants::kLocationExitedPark);
 
@@ -979,55 +1137,36 @@ void Engine::ParkStatusWaiting(int group)
 	}
 	else
 	{
-		if (GVisitorController->Groups[group].Behaviour.waitingTime == 0)
-		{
-			GVisitorController->Groups[group].SetStatusForAllVisitors(GroupParkStatus::Idle, VisitorParkStatus::Idle);
-		}
-		else
-		{
-			GVisitorController->Groups[group].SetStatForAllVisitors(GroupVisitorStat::TimeSpentWaiting);
-
-			GVisitorController->Groups[group].Behaviour.waitingTime--;
-		}
+		GVisitorController->Groups[group].SetStatusForAllVisitors(GroupParkStatus::Idle, VisitorParkStatus::Idle);
 	}
 }
 
 
+// the group has reached the eatery
 void Engine::ParkStatusTravellingFood(int group)
 {
-	if (GVisitorController->Groups[group].Behaviour.travelling.minutesLeft == 0)
-	{
-		GVisitorController->Groups[group].UpdateLocation(GParkController->Eateries[GVisitorController->Groups[group].Behaviour.travelling.toEatery].X,
-			GParkController->Eateries[GVisitorController->Groups[group].Behaviour.travelling.toEatery].Y);
+	GVisitorController->Groups[group].UpdateLocation(GParkController->Eateries[GVisitorController->Groups[group].Behaviour.travelling.toEatery].X,
+		GParkController->Eateries[GVisitorController->Groups[group].Behaviour.travelling.toEatery].Y);
 
-		if (ParkOpen)
-		{
-			int Eatery = GVisitorController->Groups[group].Behaviour.travelling.toEatery;
+	if (ParkOpen)
+	{
+		int Eatery = GVisitorController->Groups[group].Behaviour.travelling.toEatery;
 
-			GParkController->Eateries[Eatery].AddToQueue(group);
+		GParkController->Eateries[Eatery].AddToQueue(group);
 
-			GVisitorController->Groups[group].SetAtEateryQueuing(Eatery);
-		}
-		else
-		{
-			GVisitorController->Groups[group].UpdateLocation(Constants::kLocationExitedPark, Constants::kLocationExitedPark);
-		}
+		GVisitorController->Groups[group].SetAtEateryQueuing(Eatery);
 	}
 	else
 	{
-		GVisitorController->Groups[group].Behaviour.travelling.minutesLeft--;
-
-		GVisitorController->Groups[group].SetStatForAllVisitors(GroupVisitorStat::TimeSpentTravellingFood);// to do
-
-		GVisitorController->Groups[group].UpdateTravellingLocation();
+		GVisitorController->Groups[group].UpdateLocation(Constants::kLocationExitedPark, Constants::kLocationExitedPark);
 	}
 }
 
 
+// the group is due to leave, or has finished eating
 void Engine::ParkStatusEating(int group)
 {
-	if ((CurrentTime.minutes >= GVisitorController->Groups[group].Configuration.departureTime.minutes && CurrentTime.hours == GVisitorController->Groups[group].Configuration.departureTime.hours)
-		|| !ParkOpen)
+	if (GVisitorController->HotState.IsDeparting(group, CurrentTime) || !ParkOpen)
 	{
 		GVisitorController->Groups[group].UpdateLocation(Constants::kLocationExitedPark, Constants::kLocationExitedPark);
 
@@ -1035,18 +1174,9 @@ void Engine::ParkStatusEating(int group)
 	}
 	else
 	{
-		if (GVisitorController->Groups[group].Behaviour.waitingTime == 0)
-		{
-			GVisitorController->Groups[group].SetStatusForAllVisitors(GroupParkStatus::Idle, VisitorParkStatus::Idle);
-
-			GVisitorController->Groups[group].ResetFoodDrink();
-		}
-		else
-		{
-			GVisitorController->Groups[group].SetStatForAllVisitors(GroupVisitorStat::TimeSpentEating);
+		GVisitorController->Groups[group].SetStatusForAllVisitors(GroupParkStatus::Idle, VisitorParkStatus::Idle);
 
-			GVisitorController->Groups[group].Behaviour.waitingTime--;
-		}
+		GVisitorController->Groups[group].ResetFoodDrink();
 	}
 }
 
@@ -1082,11 +1212,11 @@ void Engine::ShowLiveStats()
 
 	if (FastPassMode == FastPassType::None)
 	{ 
-		log = Utility::FormatTime(CurrentTime.hours, CurrentTime.minutes) + L"  " + Utility::PadRight(VisitorsInPark, 6) + L" q: " + Utility::PadRight(Queue, 6) + L" r: " + Utility::PadRight(Riding, 6) + L"   (" + Utility::PadRight(AtRide, 6) + L" / " + Utility::PadRight(VisitorsInPark, 6) + L") " + ReportUtility::BarGraph(pcriding);
+		log = Utility::FormatTime(CurrentTime) + L"  " + Utility::PadRight(VisitorsInPark, 6) + L" q: " + Utility::PadRight(Queue, 6) + L" r: " + Utility::PadRight(Riding, 6) + L"   (" + Utility::PadRight(AtRide, 6) + L" / " + Utility::PadRight(VisitorsInPark, 6) + L") " + ReportUtility::BarGraph(pcriding);
 	}
 	else
 	{
-		log = Utility::FormatTime(CurrentTime.hours, CurrentTime.minutes) + L"  " + Utility::PadRight(VisitorsInPark, 6) + L" q: " + Utility::PadRight(Queue, 6) + L" qfp: " + Utility::PadRight(QueueFP, 6) + L" r: " + Utility::PadRight(Riding, 6) + L"   (" + Utility::PadRight(AtRide, 6) + L" / " + Utility::PadRight(VisitorsInPark, 6) + L") " + ReportUtility::BarGraph(pcriding);
+		log = Utility::FormatTime(CurrentTime) + L"  " + Utility::PadRight(VisitorsInPark, 6) + L" q: " + Utility::PadRight(Queue, 6) + L" qfp: " + Utility::PadRight(QueueFP, 6) + L" r: " + Utility::PadRight(Riding, 6) + L"   (" + Utility::PadRight(AtRide, 6) + L" / " + Utility::PadRight(VisitorsInPark, 6) + L") " + ReportUtility::BarGraph(pcriding);
 	}
 
 	OutputStatus(L"    " + log);
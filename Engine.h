@@ -14,12 +14,32 @@
 
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Constants.h"
 #include "QWaitTypes.h"
 
 
+enum EngineFeature { kFeatureFoodDrink = 1, kFeatureFastPass = 2, kFeatureMinuteStats = 4, kFeatureVisitorLocation = 8, kFeatureProfile = 16 };
+
+static const int kEngineFeatureCombinations = 32;
+
+
+// the options the engine would otherwise test for every group and every ride, every minute. the day is run
+// by the instantiation for the configuration, so the checks (and the work for anything switched off) go
+// at compile time
+template <int Flags>
+struct EngineFeatures
+{
+	static constexpr bool FoodDrink = (Flags & kFeatureFoodDrink) != 0;
+	static constexpr bool FastPass = (Flags & kFeatureFastPass) != 0;
+	static constexpr bool MinuteStats = (Flags & kFeatureMinuteStats) != 0;
+	static constexpr bool VisitorLocation = (Flags & kFeatureVisitorLocation) != 0;
+	static constexpr bool Profile = (Flags & kFeatureProfile) != 0;
+};
+
+
 class Engine
 {
 	bool ShowOutput;
@@ -30,19 +50,37 @@ class Engine
 	bool HandleFoodDrink = false;
 
 	QWaitTypes::Time CurrentTime;
-	int TimeParkCloses;
-	int TimeRidesClose;
+	QWaitTypes::Time TimeParkCloses;
+	QWaitTypes::Time TimeRidesClose;
+
+	int TicksPerMinute = 1;		// the engine steps in ticks; CurrentTime moves on every TicksPerMinute ticks
+	int CurrentTick = 0;		// tick within the current minute
+	int DayTick = 0;			// ticks since the park opened
+
+	int EntranceAdmitted = 0;	// groups let in so far this minute
 
 	int Temperature = 20;
 
 	int UpdateRate = 15; // every n minutes
 
+	void StartMinute();
 	void UpdateClock();
 
+	int ReleasedThisMinute(int);
+	bool CanProcess(int, int);
+
 	void OutputStatus(const std::wstring);
 
+	template <int... Flags>
+	void Dispatch(int, std::integer_sequence<int, Flags...>);
+
+	template <typename Features>
+	void RunDay();
+
+	template <typename Features>
 	QWaitTypes::GetRide GetRide(int);
 	int IsRideAvailableCloser(int, int);
+	template <typename Features>
 	QWaitTypes::FastPass IsFastPassTicketSoon(int, int);
 
 	void PreArrivalFastPass();
@@ -62,7 +100,9 @@ class Engine
 	void EateryEmptyQueue(int);
 
 	void ParkStatusEntrance(int);
+	template <typename Features>
 	void ParkStatusIdle(int);
+	template <typename Features>
 	void ParkStatusRiding(int);
 	void ParkStatusTravellingRide(int);
 	void ParkStatusWaiting(int);
@@ -76,7 +116,7 @@ public:
 
 	int VisitorsInPark = 0;
 
-	Engine(FastPassType, int, int, bool, int, bool, int);
+	Engine(FastPassType, int, int, bool, int, bool, int, int);
 
 	void Run(bool, bool);	
 };
\ No newline at end of file
@@ -0,0 +1,656 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include <algorithm>
+#include <cstdint>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "GZip.h"
+
+
+namespace
+{
+	static const int kMinMatch = 3;
+	static const int kMaxMatch = 258;
+
+	static const int kLengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	static const int kLengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+	static const int kDistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+	static const int kDistanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+	static const int kCodeLengthOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+	int LengthCode(int length)
+	{
+		int c = 28;
+
+		while (kLengthBase[c] > length)
+		{
+			c--;
+		}
+
+		return c;
+	}
+
+	int DistanceCode(int distance)
+	{
+		return static_cast<int>(std::upper_bound(kDistanceBase, kDistanceBase + 30, distance) - kDistanceBase) - 1;
+	}
+
+	int Hash(const unsigned char* p)
+	{
+		return ((p[0] << 10) ^ (p[1] << 5) ^ p[2]) & (kDeflateHashSize - 1);
+	}
+
+	std::vector<uint32_t> BuildCrcTable()
+	{
+		std::vector<uint32_t> table(256);
+
+		for (uint32_t n = 0; n < 256; n++)
+		{
+			uint32_t c = n;
+
+			for (int k = 0; k < 8; k++)
+			{
+				c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+			}
+
+			table[n] = c;
+		}
+
+		return table;
+	}
+
+	uint32_t UpdateCrc(uint32_t crc, const char* data, size_t length)
+	{
+		static const std::vector<uint32_t> crc_table = BuildCrcTable();
+
+		crc = crc ^ 0xFFFFFFFF;
+
+		for (size_t i = 0; i < length; i++)
+		{
+			crc = crc_table[(crc ^ static_cast<unsigned char>(data[i])) & 0xFF] ^ (crc >> 8);
+		}
+
+		return crc ^ 0xFFFFFFFF;
+	}
+}
+
+
+// =======================================================================================================================
+// == DeflateEncoder =====================================================================================================
+// =======================================================================================================================
+
+
+DeflateEncoder::DeflateEncoder()
+{
+	Head.resize(kDeflateHashSize);
+	Prev.resize(kDeflateWindowSize);
+
+	Symbols.reserve(kDeflateSymbolsPerBlock);
+}
+
+
+// deflate writes values least significant bit first
+void DeflateEncoder::PutBits(uint32_t value, int count)
+{
+	BitBuffer |= static_cast<uint64_t>(value) << BitCount;
+	BitCount += count;
+
+	while (BitCount >= 8)
+	{
+		Output->push_back(static_cast<char>(BitBuffer & 0xFF));
+
+		BitBuffer >>= 8;
+		BitCount -= 8;
+	}
+}
+
+
+void DeflateEncoder::AlignToByte()
+{
+	if (BitCount > 0)
+	{
+		Output->push_back(static_cast<char>(BitBuffer & 0xFF));
+	}
+
+	BitBuffer = 0;
+	BitCount = 0;
+}
+
+
+void DeflateEncoder::Compress(const char* data, size_t length, std::string& output)
+{
+	Output = &output;
+
+	const unsigned char* input = reinterpret_cast<const unsigned char*>(data);
+
+	std::fill(Head.begin(), Head.end(), -1);
+
+	size_t pos = 0;
+
+	while (pos < length)
+	{
+		int best_length = 0;
+		int best_distance = 0;
+
+		if (pos + kMinMatch <= length)
+		{
+			int h = Hash(input + pos);
+
+			int candidate = Head[h];
+			int chain = kDeflateMaxChain;
+
+			int max_length = static_cast<int>(std::min<size_t>(kMaxMatch, length - pos));
+
+			while (candidate >= 0 && pos - candidate <= kDeflateWindowSize && chain-- > 0)
+			{
+				if (input[candidate + best_length] == input[pos + best_length])
+				{
+					int l = 0;
+
+					while (l < max_length && input[candidate + l] == input[pos + l])
+					{
+						l++;
+					}
+
+					if (l > best_length)
+					{
+						best_length = l;
+						best_distance = static_cast<int>(pos - candidate);
+
+						if (l == max_length)
+						{
+							break;
+						}
+					}
+				}
+
+				int next = Prev[candidate & (kDeflateWindowSize - 1)];
+
+				// the window is circular, so an overwritten slot can point forwards
+				if (next >= candidate)
+				{
+					break;
+				}
+
+				candidate = next;
+			}
+		}
+
+		int advance = 1;
+
+		if (best_length >= kMinMatch)
+		{
+			Symbols.push_back({ static_cast<uint16_t>(best_length), static_cast<uint16_t>(best_distance) });
+
+			advance = best_length;
+		}
+		else
+		{
+			Symbols.push_back({ input[pos], 0 });
+		}
+
+		for (int i = 0; i < advance; i++, pos++)
+		{
+			if (pos + kMinMatch <= length)
+			{
+				int h = Hash(input + pos);
+
+				Prev[pos & (kDeflateWindowSize - 1)] = Head[h];
+				Head[h] = static_cast<int>(pos);
+			}
+		}
+
+		if (Symbols.size() >= kDeflateSymbolsPerBlock)
+		{
+			WriteBlock();
+		}
+	}
+
+	if (Symbols.size() != 0)
+	{
+		WriteBlock();
+	}
+}
+
+
+// an empty final block (fixed Huffman, end-of-block only) closes the stream
+void DeflateEncoder::Finish(std::string& output)
+{
+	Output = &output;
+
+	PutBits(1, 1);
+	PutBits(1, 2);
+	PutBits(0, 7);
+
+	AlignToByte();
+}
+
+
+// Huffman code lengths limited to max_bits; frequencies are flattened until the tree fits
+void DeflateEncoder::BuildLengths(const std::vector<uint32_t>& frequency, int max_bits, std::vector<uint8_t>& lengths)
+{
+	size_t count = frequency.size();
+
+	std::vector<uint32_t> freq = frequency;
+
+	int used = 0;
+
+	for (size_t s = 0; s < count; s++)
+	{
+		if (freq[s] != 0)
+		{
+			used++;
+		}
+	}
+
+	// a valid tree needs at least two codes
+	for (size_t s = 0; s < count && used < 2; s++)
+	{
+		if (freq[s] == 0)
+		{
+			freq[s] = 1;
+			used++;
+		}
+	}
+
+	while (true)
+	{
+		typedef std::pair<uint64_t, int> Node;
+
+		std::priority_queue<Node, std::vector<Node>, std::greater<Node>> heap;
+
+		std::vector<int> parent(count * 2, -1);
+
+		for (size_t s = 0; s < count; s++)
+		{
+			if (freq[s] != 0)
+			{
+				heap.push({ freq[s], static_cast<int>(s) });
+			}
+		}
+
+		int next_node = static_cast<int>(count);
+
+		while (heap.size() > 1)
+		{
+			Node a = heap.top(); heap.pop();
+			Node b = heap.top(); heap.pop();
+
+			parent[a.second] = next_node;
+			parent[b.second] = next_node;
+
+			heap.push({ a.first + b.first, next_node });
+
+			next_node++;
+		}
+
+		lengths.assign(count, 0);
+
+		int longest = 0;
+
+		for (size_t s = 0; s < count; s++)
+		{
+			if (freq[s] != 0)
+			{
+				int depth = 0;
+
+				for (int n = static_cast<int>(s); parent[n] != -1; n = parent[n])
+				{
+					depth++;
+				}
+
+				lengths[s] = static_cast<uint8_t>(depth);
+
+				longest = std::max(longest, depth);
+			}
+		}
+
+		if (longest <= max_bits)
+		{
+			return;
+		}
+
+		for (size_t s = 0; s < count; s++)
+		{
+			if (freq[s] != 0)
+			{
+				freq[s] = (freq[s] >> 1) | 1;
+			}
+		}
+	}
+}
+
+
+// canonical codes (RFC 1951 3.2.2), stored bit-reversed ready for PutBits
+void DeflateEncoder::BuildCodes(const std::vector<uint8_t>& lengths, std::vector<uint16_t>& codes)
+{
+	int length_count[16] = { 0 };
+
+	for (size_t s = 0; s < lengths.size(); s++)
+	{
+		length_count[lengths[s]]++;
+	}
+
+	length_count[0] = 0;
+
+	int next_code[16] = { 0 };
+	int code = 0;
+
+	for (int bits = 1; bits < 16; bits++)
+	{
+		code = (code + length_count[bits - 1]) << 1;
+		next_code[bits] = code;
+	}
+
+	codes.assign(lengths.size(), 0);
+
+	for (size_t s = 0; s < lengths.size(); s++)
+	{
+		int len = lengths[s];
+
+		if (len != 0)
+		{
+			int c = next_code[len]++;
+			int reversed = 0;
+
+			for (int b = 0; b < len; b++)
+			{
+				reversed = (reversed << 1) | ((c >> b) & 1);
+			}
+
+			codes[s] = static_cast<uint16_t>(reversed);
+		}
+	}
+}
+
+
+void DeflateEncoder::WriteBlock()
+{
+	std::vector<uint32_t> litlen_freq(286, 0);
+	std::vector<uint32_t> distance_freq(30, 0);
+
+	for (size_t i = 0; i < Symbols.size(); i++)
+	{
+		if (Symbols[i].distance == 0)
+		{
+			litlen_freq[Symbols[i].value]++;
+		}
+		else
+		{
+			litlen_freq[257 + LengthCode(Symbols[i].value)]++;
+			distance_freq[DistanceCode(Symbols[i].distance)]++;
+		}
+	}
+
+	litlen_freq[256] = 1;
+
+	std::vector<uint8_t> litlen_lengths;
+	std::vector<uint8_t> distance_lengths;
+
+	BuildLengths(litlen_freq, 15, litlen_lengths);
+	BuildLengths(distance_freq, 15, distance_lengths);
+
+	std::vector<uint16_t> litlen_codes;
+	std::vector<uint16_t> distance_codes;
+
+	BuildCodes(litlen_lengths, litlen_codes);
+	BuildCodes(distance_lengths, distance_codes);
+
+	int hlit = 286;
+
+	while (hlit > 257 && litlen_lengths[hlit - 1] == 0)
+	{
+		hlit--;
+	}
+
+	int hdist = 30;
+
+	while (hdist > 1 && distance_lengths[hdist - 1] == 0)
+	{
+		hdist--;
+	}
+
+	// == run-length encode the code lengths ==============================================================================
+
+	std::vector<uint8_t> all_lengths(litlen_lengths.begin(), litlen_lengths.begin() + hlit);
+
+	all_lengths.insert(all_lengths.end(), distance_lengths.begin(), distance_lengths.begin() + hdist);
+
+	std::vector<std::pair<int, int>> runs;	// code length symbol, extra bits value
+
+	for (size_t i = 0; i < all_lengths.size();)
+	{
+		int len = all_lengths[i];
+		size_t run = 1;
+
+		while (i + run < all_lengths.size() && all_lengths[i + run] == len)
+		{
+			run++;
+		}
+
+		if (len == 0 && run >= 11)
+		{
+			int r = static_cast<int>(std::min<size_t>(run, 138));
+
+			runs.push_back({ 18, r - 11 });
+			i += r;
+		}
+		else if (len == 0 && run >= 3)
+		{
+			runs.push_back({ 17, static_cast<int>(run) - 3 });
+			i += run;
+		}
+		else if (len != 0 && run >= 4)
+		{
+			runs.push_back({ len, 0 });
+
+			int r = static_cast<int>(std::min<size_t>(run - 1, 6));
+
+			runs.push_back({ 16, r - 3 });
+			i += 1 + r;
+		}
+		else
+		{
+			runs.push_back({ len, 0 });
+			i++;
+		}
+	}
+
+	std::vector<uint32_t> cl_freq(19, 0);
+
+	for (size_t i = 0; i < runs.size(); i++)
+	{
+		cl_freq[runs[i].first]++;
+	}
+
+	std::vector<uint8_t> cl_lengths;
+	std::vector<uint16_t> cl_codes;
+
+	BuildLengths(cl_freq, 7, cl_lengths);
+	BuildCodes(cl_lengths, cl_codes);
+
+	int hclen = 19;
+
+	while (hclen > 4 && cl_lengths[kCodeLengthOrder[hclen - 1]] == 0)
+	{
+		hclen--;
+	}
+
+	// == block header ====================================================================================================
+
+	PutBits(0, 1);		// not final, Finish() adds an empty final block
+	PutBits(2, 2);		// dynamic Huffman
+
+	PutBits(hlit - 257, 5);
+	PutBits(hdist - 1, 5);
+	PutBits(hclen - 4, 4);
+
+	for (int i = 0; i < hclen; i++)
+	{
+		PutBits(cl_lengths[kCodeLengthOrder[i]], 3);
+	}
+
+	for (size_t i = 0; i < runs.size(); i++)
+	{
+		int symbol = runs[i].first;
+
+		PutBits(cl_codes[symbol], cl_lengths[symbol]);
+
+		if (symbol == 16)
+		{
+			PutBits(runs[i].second, 2);
+		}
+		else if (symbol == 17)
+		{
+			PutBits(runs[i].second, 3);
+		}
+		else if (symbol == 18)
+		{
+			PutBits(runs[i].second, 7);
+		}
+	}
+
+	// == data ============================================================================================================
+
+	for (size_t i = 0; i < Symbols.size(); i++)
+	{
+		if (Symbols[i].distance == 0)
+		{
+			PutBits(litlen_codes[Symbols[i].value], litlen_lengths[Symbols[i].value]);
+		}
+		else
+		{
+			int lc = LengthCode(Symbols[i].value);
+
+			PutBits(litlen_codes[257 + lc], litlen_lengths[257 + lc]);
+			PutBits(Symbols[i].value - kLengthBase[lc], kLengthExtra[lc]);
+
+			int dc = DistanceCode(Symbols[i].distance);
+
+			PutBits(distance_codes[dc], distance_lengths[dc]);
+			PutBits(Symbols[i].distance - kDistanceBase[dc], kDistanceExtra[dc]);
+		}
+	}
+
+	PutBits(litlen_codes[256], litlen_lengths[256]);
+
+	Symbols.clear();
+}
+
+
+// =======================================================================================================================
+// == GZipStream =========================================================================================================
+// =======================================================================================================================
+
+
+GZipStream::GZipStream(std::ofstream& file) : File(file)
+{
+	static const char header[10] = { 0x1f, static_cast<char>(0x8b), 8, 0, 0, 0, 0, 0, 0, static_cast<char>(0xff) };
+
+	File.write(header, 10);
+
+	Worker = std::thread(&GZipStream::Compress, this);
+}
+
+
+GZipStream::~GZipStream()
+{
+	Close();
+}
+
+
+// blocks the caller while the compressor is too far behind, keeping memory use bounded
+void GZipStream::Write(std::string&& block)
+{
+	std::unique_lock<std::mutex> lock(Lock);
+
+	QueueChanged.wait(lock, [this] { return Queue.size() < kGZipMaxQueuedBlocks; });
+
+	Queue.push_back(std::move(block));
+
+	QueueChanged.notify_all();
+}
+
+
+void GZipStream::Close()
+{
+	if (Worker.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(Lock);
+
+			Closing = true;
+		}
+
+		QueueChanged.notify_all();
+
+		Worker.join();
+	}
+}
+
+
+void GZipStream::Compress()
+{
+	std::string output;
+
+	while (true)
+	{
+		std::string block;
+
+		{
+			std::unique_lock<std::mutex> lock(Lock);
+
+			QueueChanged.wait(lock, [this] { return Queue.size() != 0 || Closing; });
+
+			if (Queue.size() == 0)
+			{
+				break;
+			}
+
+			block = std::move(Queue.front());
+
+			Queue.pop_front();
+		}
+
+		QueueChanged.notify_all();
+
+		Crc = UpdateCrc(Crc, block.data(), block.size());
+		Size += static_cast<uint32_t>(block.size());
+
+		output.clear();
+
+		Encoder.Compress(block.data(), block.size(), output);
+
+		File.write(output.data(), output.size());
+	}
+
+	output.clear();
+
+	Encoder.Finish(output);
+
+	for (int i = 0; i < 4; i++)
+	{
+		output.push_back(static_cast<char>((Crc >> (i * 8)) & 0xFF));
+	}
+
+	for (int i = 0; i < 4; i++)
+	{
+		output.push_back(static_cast<char>((Size >> (i * 8)) & 0xFF));
+	}
+
+	File.write(output.data(), output.size());
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+static const int kDeflateWindowSize = 32768;
+static const int kDeflateHashSize = 32768;
+static const int kDeflateMaxChain = 24;					// match candidates checked per position
+static const size_t kDeflateSymbolsPerBlock = 65536;	// a new set of Huffman tables every n symbols
+
+static const size_t kGZipMaxQueuedBlocks = 4;			// formatting waits once this many blocks are queued for compression
+
+
+struct DeflateSymbol {
+	uint16_t value = 0;		// literal (distance == 0) or match length
+	uint16_t distance = 0;
+};
+
+
+// raw DEFLATE (RFC 1951) encoder; greedy LZ77 over a 32K window with dynamic Huffman blocks.
+// each call to Compress() is matched independently, which costs very little on multi-megabyte blocks
+class DeflateEncoder
+{
+	std::string* Output = nullptr;
+
+	uint64_t BitBuffer = 0;
+	int BitCount = 0;
+
+	std::vector<int> Head;
+	std::vector<int> Prev;
+
+	std::vector<DeflateSymbol> Symbols;
+
+	void PutBits(uint32_t, int);
+	void AlignToByte();
+
+	void WriteBlock();
+
+	void BuildLengths(const std::vector<uint32_t>&, int, std::vector<uint8_t>&);
+	void BuildCodes(const std::vector<uint8_t>&, std::vector<uint16_t>&);
+
+public:
+
+	DeflateEncoder();
+
+	void Compress(const char*, size_t, std::string&);
+	void Finish(std::string&);
+};
+
+
+// streams a gzip (RFC 1952) file; blocks are compressed on a separate thread so that
+// compression overlaps with formatting the rest of the report
+class GZipStream
+{
+	std::ofstream& File;
+
+	DeflateEncoder Encoder;
+
+	uint32_t Crc = 0;
+	uint32_t Size = 0;
+
+	std::deque<std::string> Queue;
+	std::mutex Lock;
+	std::condition_variable QueueChanged;
+
+	bool Closing = false;
+
+	std::thread Worker;
+
+	void Compress();
+
+public:
+
+	GZipStream(std::ofstream&);
+	~GZipStream();
+
+	void Write(std::string&&);
+	void Close();
+};
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include "Configuration.h"
 #include "GlobalController.h"
 #include "ParkController.h"
+#include "Profiler.h"
 #include "ReportController.h"
 #include "VisitorController.h"
 
@@ -37,6 +38,10 @@ namespace GlobalControllers
 		}
 
 		GVisitorController = new VisitorController(GConfiguration->VisitorCount, !GConfiguration->DebugConfig.DisableConsoleOutput, GConfiguration->HandleFoodDrink, GConfiguration->RideTemplate, GConfiguration->GetVisitorNames);
+
+		GReportController = new ReportController(!GConfiguration->DebugConfig.DisableConsoleOutput);
+
+		GProfiler = new Profiler(GConfiguration->DebugConfig.Profile);
 		
 		return 0;
 	}
@@ -53,6 +58,16 @@ namespace GlobalControllers
 			delete GVisitorController;
 		}
 
+		if (GReportController != nullptr)
+		{
+			delete GReportController;
+		}
+
+		if (GProfiler != nullptr)
+		{
+			delete GProfiler;
+		}
+
 		if (GConfiguration != nullptr)
 		{
 			delete GConfiguration;
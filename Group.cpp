@@ -12,46 +12,66 @@
 
 #include <algorithm>
 #include <iostream>
+#include <random>
 #include <sstream>
 #include <time.h>
 
 #include "Constants.h"
 #include "Group.h"
+#include "GroupHotState.h"
 
 
 // results in a list where Rides[0] is the high popularity
 bool sortByTime(const QWaitTypes::FastPass& r1, const QWaitTypes::FastPass& r2)
 {
-	return r1.ticket.hours < r2.ticket.hours;
+	return r1.ticket < r2.ticket;
 }
 
 
-Group::Group(GroupType group_type, int template_id)
+namespace
+{
+	// groups are generated on several threads at once, so each thread passes in its own generator
+	// (rand() isn't safe to share, and per-thread CRT state would give every thread the same sequence)
+	double RandomDouble(std::mt19937& generator)
+	{
+		return std::uniform_real_distribution<double>(0.0, 1.0)(generator);
+	}
+
+
+	// 0 to range - 1
+	int RandomInt(std::mt19937& generator, int range)
+	{
+		return std::uniform_int_distribution<int>(0, range - 1)(generator);
+	}
+}
+
+
+Group::Group(GroupType group_type, int template_id, std::mt19937& generator)
 {
 	Configuration.templateID = template_id;
 
 	Configuration.type = group_type;
 
-	SetGroupSettings();
+	SetGroupSettings(generator);
 
-	double random = (double)rand() / RAND_MAX;
+	double random = RandomDouble(generator);
 
 	switch (Configuration.type)
 	{
 	case GroupType::Family:
-		BuildFamily(random);
+		BuildFamily(random, generator);
 		break;
 		
 	case GroupType::AdultCouple:
-		BuildAdultCouple(random);
+		BuildAdultCouple(random, generator);
 		break;
 
 	case GroupType::AdultGroup:
-		BuildAdultGroup(random);
+		BuildAdultGroup(random, generator);
 		break;
 
 	case GroupType::Single:
-		BuildSingle(random);
+		BuildSingle(random, generator);
 		break;
 	}
 
@@ -84,8 +104,8 @@ Group::Group(int type, int template_id, int stay_duration, bool staying_on_site,
 	Configuration.stayDuration = stay_duration;
 	Configuration.stayingOnSite = staying_on_site;
 
-	Configuration.arrivalTime = { arrival_hours, arrival_minutes };
-	Configuration.departureTime = { depart_hours, depart_minutes };
+	Configuration.arrivalTime = QWaitTypes::MakeTime(arrival_hours, arrival_minutes);
+	Configuration.departureTime = QWaitTypes::MakeTime(depart_hours, depart_minutes);
 
 	Behaviour.maximumRideWaitingTime = GetMaximumWaitingTime();
 
@@ -109,7 +129,7 @@ void Group::Demographics()
 }
 
 
-void Group::BuildFamily(double random)
+void Group::BuildFamily(double random, std::mt19937& generator)
 {
 	int ChildrenCount = 0;
 
@@ -134,34 +154,38 @@ void Group::BuildFamily(double random)
 		ChildrenCount = 5;
 	}	
 
-	Visitors.push_back(Visitor(GetVisitorGenericAdult()));	// add our two adults
-	Visitors.push_back(Visitor(GetVisitorGenericAdult()));
+	Visitors.reserve(2 + ChildrenCount);
+
+	Visitors.emplace_back(GetVisitorGenericAdult(generator));	// add our two adults
+	Visitors.emplace_back(GetVisitorGenericAdult(generator));
 
 	for (int c = 0; c < ChildrenCount; c++)
 	{
-		Visitors.push_back(Visitor(GetVisitorGenericChild()));
+		Visitors.emplace_back(GetVisitorGenericChild(generator));
 	}
 
 	Behaviour.consumption.Threshold = kFamilyConsumptionThreshold;
 }
 
 
-void Group::BuildAdultCouple(double random)
+void Group::BuildAdultCouple(double random, std::mt19937& generator)
 {
-	double r = ((double)rand() / double(RAND_MAX)) * 0.75;
+	double r = RandomDouble(generator) * 0.75;
 
 	NewVisitorConfiguration vtc = GetBaseVisitorConfiguration(GetType(r));
 
 	vtc.age = AgeGroup::Adult;
 
-	Visitors.push_back(Visitor(vtc));
-	Visitors.push_back(Visitor(vtc));
+	Visitors.reserve(2);
+
+	Visitors.emplace_back(vtc);
+	Visitors.emplace_back(vtc);
 
 	Behaviour.consumption.Threshold = kAdultCoupleConsumptionThreshold;
 }
 
 
-void Group::BuildAdultGroup(double random)
+void Group::BuildAdultGroup(double random, std::mt19937& generator)
 {
 	int GroupCount = 0;
 
@@ -186,77 +210,85 @@ void Group::BuildAdultGroup(double random)
 		GroupCount = 6;
 	}
 
+	Visitors.reserve(GroupCount);
+
 	for (int g = 0; g < GroupCount; g++)
 	{
-		Visitors.push_back(Visitor(GetBaseVisitorConfiguration(GetType((double)rand() / double(RAND_MAX)))));
+		Visitors.emplace_back(GetBaseVisitorConfiguration(GetType(RandomDouble(generator))));
 	}
 
 	Behaviour.consumption.Threshold = kAdultGroupConsumptionThreshold;
 }
 
 
-void Group::BuildSingle(double random)
+void Group::BuildSingle(double random, std::mt19937& generator)
 {
-	Visitors.push_back(Visitor(GetBaseVisitorConfiguration(GetType((double)rand() / double(RAND_MAX)))));
+	Visitors.emplace_back(GetBaseVisitorConfiguration(GetType(RandomDouble(generator))));
 
 	Behaviour.consumption.Threshold = kSingleConsumptionThreshold;
 }
 
 
-void Group::SetGroupSettings()
+void Group::SetGroupSettings(std::mt19937& generator)
 {
+	int arrival_hours = 0;
+	int departure_hours = 0;
+
 	switch (Configuration.type)
 	{
 	case GroupType::Family:
 		Configuration.stayDuration = 11;
 
-		Configuration.arrivalTime.hours = 10 + rand() % 2;
-		Configuration.departureTime.hours = Configuration.arrivalTime.hours + Configuration.stayDuration;
+		arrival_hours = 10 + RandomInt(generator, 2);
+		departure_hours = arrival_hours + Configuration.stayDuration;
 		break;
 
 	case GroupType::AdultCouple:
 		Configuration.stayDuration = 11;
 
-		Configuration.arrivalTime.hours = 10 + rand() % 3;
-		Configuration.departureTime.hours = Configuration.arrivalTime.hours + Configuration.stayDuration;
+		arrival_hours = 10 + RandomInt(generator, 3);
+		departure_hours = arrival_hours + Configuration.stayDuration;
 		break;
 
 	case GroupType::AdultGroup:
 		Configuration.stayDuration = 11;
 
-		Configuration.arrivalTime.hours = 10 + rand() % 3;
-		Configuration.departureTime.hours = Configuration.arrivalTime.hours + Configuration.stayDuration;
+		arrival_hours = 10 + RandomInt(generator, 3);
+		departure_hours = arrival_hours + Configuration.stayDuration;
 		break;
 
 	case GroupType::Single:
 		Configuration.stayDuration = 11;
 
-		Configuration.arrivalTime.hours = 10 + rand() % 5;
-		Configuration.departureTime.hours = Configuration.arrivalTime.hours + Configuration.stayDuration;
+		arrival_hours = 10 + RandomInt(generator, 5);
+		departure_hours = arrival_hours + Configuration.stayDuration;
 		break;
 	}
 
-	Configuration.arrivalTime.minutes = rand() % 60;
-	Configuration.departureTime.minutes = rand() % 60;
+	int arrival_minutes = RandomInt(generator, 60);
+	int departure_minutes = RandomInt(generator, 60);
 
 	// a certain percentage of groups are staying on-site and get in early
-	int OnSite = rand() % 100;
+	int OnSite = RandomInt(generator, 100);
 
 	if (OnSite < Constants::PercentageStayingOnSiteStartingEarly)
 	{
 		Configuration.stayingOnSite = true;
 
-		Configuration.arrivalTime.hours = 9;
-		Configuration.departureTime.hours = Configuration.arrivalTime.hours + Configuration.stayDuration + rand() % 2;
+		arrival_hours = 9;
+		departure_hours = arrival_hours + Configuration.stayDuration + RandomInt(generator, 2);
 
-		Configuration.arrivalTime.minutes = rand() % 21; // if you're arriving for 9am you probably aren't going to be too late getting there ;)
+		arrival_minutes = RandomInt(generator, 21); // if you're arriving for 9am you probably aren't going to be too late getting there ;)
 	}
 	else
 	{
 		Configuration.stayingOnSite = false;
 	}
 
-	Configuration.departureTime.minutes = Configuration.arrivalTime.minutes;
+	departure_minutes = arrival_minutes;
+
+	Configuration.arrivalTime = QWaitTypes::MakeTime(arrival_hours, arrival_minutes);
+	Configuration.departureTime = QWaitTypes::MakeTime(departure_hours, departure_minutes);
 }
 
 
@@ -291,9 +323,9 @@ VisitorType Group::GetType(double random)
 }
 
 
-NewVisitorConfiguration Group::GetVisitorGenericAdult()
+NewVisitorConfiguration Group::GetVisitorGenericAdult(std::mt19937& generator)
 {
-	double r = ((double)rand() / double(RAND_MAX));
+	double r = RandomDouble(generator);
 
 	NewVisitorConfiguration vtc = GetBaseVisitorConfiguration(GetType(r));
 
@@ -303,9 +335,9 @@ NewVisitorConfiguration Group::GetVisitorGenericAdult()
 }
 
 
-NewVisitorConfiguration Group::GetVisitorGenericChild()
+NewVisitorConfiguration Group::GetVisitorGenericChild(std::mt19937& generator)
 {
-	double r = ((double)rand() / double(RAND_MAX));
+	double r = RandomDouble(generator);
 
 	NewVisitorConfiguration vtc = GetBaseVisitorConfiguration(GetType(r));
 
@@ -418,14 +450,78 @@ int Group::GetMaximumWaitingTimeFood()
 }
 
 
+GroupParkStatus Group::GetParkStatus()
+{
+	return static_cast<GroupParkStatus>(Hot->Status[ID]);
+}
+
+
 void Group::SetStatusForAllVisitors(GroupParkStatus group_park_status, VisitorParkStatus visitor_park_status)
 {
+	FlushStatusMinutes();
+
 	for (int v = 0; v < Visitors.size(); v++)
 	{
 		Visitors[v].ParkStatus = visitor_park_status;
 	}
 
-	Behaviour.parkStatus = group_park_status;
+	Hot->SetStatus(ID, group_park_status);
+}
+
+
+// GroupHotState::Advance counts the ticks a group spends in its current status; they're added to the
+// visitors here, as minutes, before anything changes the group's (or its visitors') status. with more
+// than one tick a minute the ticks are rounded to the nearest minute and the difference is carried in to
+// the next status, so the rounding doesn't build up over the day
+void Group::FlushStatusMinutes()
+{
+	if (Hot->PendingTicks[ID] == 0)
+	{
+		return;
+	}
+
+	int rounded = (Hot->PendingTicks[ID] + Hot->TicksPerMinute / 2) / Hot->TicksPerMinute;
+
+	Hot->PendingTicks[ID] -= rounded * Hot->TicksPerMinute;
+
+	if (rounded == 0)
+	{
+		return;
+	}
+
+	uint16_t minutes = static_cast<uint16_t>(rounded);
+
+	for (int v = 0; v < Visitors.size(); v++)
+	{
+		switch (GetParkStatus())
+		{
+		case GroupParkStatus::Riding:
+			if (Visitors[v].ParkStatus == VisitorParkStatus::Riding)
+			{
+				Visitors[v].TimeSpent.riding += minutes;
+			}
+			break;
+		case GroupParkStatus::Queuing:
+		case GroupParkStatus::QueuingFastPass:
+			Visitors[v].TimeSpent.queuing += minutes;
+			break;
+		case GroupParkStatus::QueuingFood:
+			Visitors[v].TimeSpent.queuingFood += minutes;
+			break;
+		case GroupParkStatus::TravellingRide:
+			Visitors[v].TimeSpent.travelling += minutes;
+			break;
+		case GroupParkStatus::TravellingFood:
+			Visitors[v].TimeSpent.travellingFood += minutes;
+			break;
+		case GroupParkStatus::Waiting:
+			Visitors[v].TimeSpent.waiting += minutes;
+			break;
+		case GroupParkStatus::Eating:
+			Visitors[v].TimeSpent.eating += minutes;
+			break;
+		}
+	}
 }
 
 
@@ -503,6 +599,8 @@ int Group::GetPostRidingWaitTime(RideExitType ride_exit_type, bool first_time)
 
 int Group::GroupRemovedFromRide(int ride, RideExitType ride_exit_type)
 {
+	FlushStatusMinutes();
+
 	int WaitTime = GetPostRidingWaitTime(ride_exit_type, IsFirstTimeRiding(ride));
 	int Riding = 0;
 
@@ -532,7 +630,7 @@ int Group::GroupRemovedFromRide(int ride, RideExitType ride_exit_type)
 		SetStatusForAllVisitors(GroupParkStatus::Waiting, VisitorParkStatus::Waiting);
 	}
 
-	Behaviour.waitingTime += WaitTime;
+	Hot->WaitingTime[ID] += WaitTime * Hot->TicksPerMinute;
 
 	return Riding;
 }
@@ -540,6 +638,8 @@ int Group::GroupRemovedFromRide(int ride, RideExitType ride_exit_type)
 
 int Group::GroupRemovedFromRideShutdown(RideExitType ride_exit_type)
 {
+	FlushStatusMinutes();
+
 	int WaitTime = kBasePostRideWaitTime;
 	int Riding = 0;
 
@@ -575,13 +675,15 @@ int Group::GroupRemovedFromRideShutdown(RideExitType ride_exit_type)
 
 void Group::SetRiding(QWaitTypes::Riders riders, int ride_ID, int ride_duration, bool from_fast_pass)
 {
+	FlushStatusMinutes();
+
 	for (int v = 0; v < riders.memberID.size(); v++)
 	{
-		Visitors[riders.memberID[v]].Rides.currentRide = ride_ID;
+		Visitors[riders.memberID[v]].Rides.currentRide = static_cast<int16_t>(ride_ID);
 
 		Visitors[riders.memberID[v]].Rides.count++;
 
-		Visitors[riders.memberID[v]].RideList.push_back(ride_ID);
+		Visitors[riders.memberID[v]].RideList.push_back(static_cast<uint16_t>(ride_ID));
 
 		if (from_fast_pass)
 		{
@@ -598,13 +700,13 @@ void Group::SetRiding(QWaitTypes::Riders riders, int ride_ID, int ride_duration,
 
 	RideList.push_back(ride_ID);
 
-	Riding.timeLeft = ride_duration;
+	Hot->RideTimeLeft[ID] = ride_duration * Hot->TicksPerMinute;
 
-	Behaviour.parkStatus = GroupParkStatus::Riding;
+	Hot->SetStatus(ID, GroupParkStatus::Riding);
 }
 
 
-void Group::SetNewRide(int ride, int fastpass_ticket, int minutes_left, int distance, QWaitTypes::Coords location)
+void Group::SetNewRide(int ride, int fastpass_ticket, int ticks_left, int distance, QWaitTypes::Coords location)
 {
 	if (ride == Constants::kNoCurrentRide)
 	{
@@ -614,7 +716,7 @@ void Group::SetNewRide(int ride, int fastpass_ticket, int minutes_left, int dist
 	Behaviour.travelling.toRide = ride; 
 	Behaviour.travelling.fastPass = fastpass_ticket;
 
-	SetTravellingMinutesLeft(minutes_left, true);
+	SetTravellingTicksLeft(ticks_left, true);
 
 	for (int v = 0; v < Visitors.size(); v++)
 	{
@@ -626,38 +728,43 @@ void Group::SetNewRide(int ride, int fastpass_ticket, int minutes_left, int dist
 }
 
 
-void Group::SetTravellingMinutesLeft(int minutes, bool ride)
+// families take a minute longer than the walk, singles a minute less
+void Group::SetTravellingTicksLeft(int ticks, bool ride)
 {
+	int ticks_left = 0;
+
 	switch (Configuration.type)
 	{
 	case GroupType::Family:
-		Behaviour.travelling.minutesLeft = minutes + 1;
+		ticks_left = ticks + Hot->TicksPerMinute;
 		break;
 
 	case GroupType::AdultCouple:
-		Behaviour.travelling.minutesLeft = minutes;
+		ticks_left = ticks;
 		break;
 
 	case GroupType::AdultGroup:
-		Behaviour.travelling.minutesLeft = minutes;
+		ticks_left = ticks;
 		break;
 
 	case GroupType::Single:
-		Behaviour.travelling.minutesLeft = minutes - 1;
+		ticks_left = ticks - Hot->TicksPerMinute;
 		break;
 	}
 
 	Behaviour.travelling.from.x = Behaviour.location.x;
 	Behaviour.travelling.from.y = Behaviour.location.y;
 
-	if (Behaviour.travelling.minutesLeft <= 0)
+	if (ticks_left <= 0)
 	{
-		Behaviour.travelling.minutesLeft = 1;
+		ticks_left = 1;
 	}
 
-	Behaviour.travelling.minutesStart = Behaviour.travelling.minutesLeft;
+	Hot->TravelTicksLeft[ID] = ticks_left;
 
-	Statistics.timeSpent.travelling += Behaviour.travelling.minutesLeft;
+	Behaviour.travelling.ticksStart = ticks_left;
+
+	Statistics.timeSpent.travelling += (ticks_left + Hot->TicksPerMinute / 2) / Hot->TicksPerMinute;
 
 	if (ride)
 	{
@@ -746,12 +853,12 @@ void Group::UpdateLastRidesList()
 // =================================================================================================================
 
 
-void Group::SetNewEatery(int eatery, int minutes_left, int distance, QWaitTypes::Coords location)
+void Group::SetNewEatery(int eatery, int ticks_left, int distance, QWaitTypes::Coords location)
 {
 	Behaviour.travelling.toEatery = eatery;
 	Behaviour.travelling.toRide = Constants::kNoCurrentRide;
 
-	SetTravellingMinutesLeft(minutes_left, false);
+	SetTravellingTicksLeft(ticks_left, false);
 
 	for (int v = 0; v < Visitors.size(); v++)
 	{
@@ -804,49 +911,10 @@ void Group::SetAtEateryQueuing(int eatery)
 }
 
 
-void Group::UpdateConsumption(int temp)
-{
-	double deltat = (0.3333 * (double)Behaviour.consumption.TimeSinceDrink * sqrt(temp));
-	double modifier = 1;
-
-	switch (Behaviour.parkStatus)
-	{
-	case GroupParkStatus::OnWay:
-	case GroupParkStatus::AtEntrance:
-	case GroupParkStatus::Exited:
-	case GroupParkStatus::QueuingFood:
-	case GroupParkStatus::Eating:
-		return;
-	
-	case GroupParkStatus::Idle:
-	case GroupParkStatus::Waiting:
-		modifier = 0.3;
-		break;
-		
-	case GroupParkStatus::Riding:
-		modifier = 0.9;
-		break;
-		
-	case GroupParkStatus::Queuing:
-	case GroupParkStatus::QueuingFastPass:
-		modifier = 0.6;
-		break;
-
-	case GroupParkStatus::TravellingRide:
-	case GroupParkStatus::TravellingFood:
-		modifier = 1;
-		break;
-	}
-
-	Behaviour.consumption.Drink += modifier * (deltat * deltat);
-}
-
-
 void Group::ResetFoodDrink()
 {
-	Behaviour.consumption.Drink = 0;
+	Hot->ResetDrink(ID);
 	Behaviour.consumption.Food = 0;
-	Behaviour.consumption.TimeSinceDrink = 0;
 }
 
 
@@ -857,7 +925,7 @@ void Group::ResetFoodDrink()
 
 void Group::SetWaiting(int time_minutes)
 {
-	Behaviour.waitingTime += time_minutes;
+	Hot->WaitingTime[ID] += time_minutes * Hot->TicksPerMinute;
 
 	SetStatusForAllVisitors(GroupParkStatus::Waiting, VisitorParkStatus::Waiting);
 }
@@ -868,61 +936,19 @@ void Group::SetWaiting(int time_minutes)
 // =================================================================================================================
 
 
-bool Group::CreateVisitorFromFileData(const std::wstring input)
+// groups loaded from a visitor file are created before their visitors, so the values
+// that depend on the visitors are set once they have all been added
+void Group::VisitorsLoaded()
 {
-	std::wstringstream visitorinput(input);
-	std::vector<std::wstring> parameters;
-	std::wstring parameter;
-
-	while (std::getline(visitorinput, parameter, L','))
-	{
-		parameters.push_back(parameter);
-	}
+	AdultCount = 0;
+	ChildCount = 0;
 
-	if (parameters.size() == 5)
-	{
-		NewVisitorConfiguration newvisitorconfig;
-
-		try
-		{
-			newvisitorconfig.name = stoi(parameters[0]);
-			newvisitorconfig.type = QWaitTypes::IntToVisitorType(stoi(parameters[1]));
-
-			switch (stoi(parameters[2]))
-			{
-			case 0:
-				newvisitorconfig.age = AgeGroup::Baby;
-				break;
-			case 1:
-				newvisitorconfig.age = AgeGroup::Child;
-				break;
-			case 2:
-				newvisitorconfig.age = AgeGroup::Adult;
-				break;
-			}
-
-			newvisitorconfig.maxWaitTime = stof(parameters[3]);
-			newvisitorconfig.preference = stof(parameters[4]);
-
-			Visitor visitor(newvisitorconfig);
-
-			Visitors.push_back(visitor);
+	Demographics();
 
-			return true;
-		}
-		catch (...)
-		{
-			std::wcerr << L"There appears to be some dodgy data in this input row:" << "\n";
-			std::wcerr << L"    \"" << input << L"\"" << std::endl;
-		}
-	}
-	else
+	if (Visitors.size() != 0)
 	{
-		std::wcerr << L"Invalid number of parameters in this visitor data (should be 5): " << parameters.size() << "\n";
-		std::wcerr << L"    \"" << input << L"\"" << std::endl;
+		Behaviour.maximumRideWaitingTime = GetMaximumWaitingTime();
 	}
-
-	return false;
 }
 
 
@@ -943,20 +969,25 @@ void Group::UpdateLocation(int x, int y)
 }
 
 
-void Group::UpdateTravellingLocation(void)
+// a journey is kept as from, to, and its length in ticks (the ticks left are counted down in Hot), so
+// nothing is done per tick; the position along the way is only worked out when it's read
+QWaitTypes::Coords Group::GetLocation()
 {
-	double dx = abs((double)Behaviour.travelling.from.x - (double)Behaviour.travelling.to.x);
-	double dy = abs((double)Behaviour.travelling.from.y - (double)Behaviour.travelling.to.y);
+	GroupParkStatus status = GetParkStatus();
 
-	double d = sqrtf(dx * dx + dy * dy);
+	if ((status != GroupParkStatus::TravellingRide && status != GroupParkStatus::TravellingFood) || Behaviour.travelling.ticksStart == 0)
+	{
+		return Behaviour.location;
+	}
 
-	double deltad = d * (((double)Behaviour.travelling.minutesStart - (double)Behaviour.travelling.minutesLeft) / (double)Behaviour.travelling.minutesStart);
+	double progress = ((double)Behaviour.travelling.ticksStart - (double)Hot->TravelTicksLeft[ID]) / (double)Behaviour.travelling.ticksStart;
 
-	int newx = static_cast<int>((deltad / d) * ((double)Behaviour.travelling.to.x - (double)Behaviour.travelling.from.x) + (double)Behaviour.travelling.from.x);
-	int newy = static_cast<int>((deltad / d) * ((double)Behaviour.travelling.to.y - (double)Behaviour.travelling.from.y) + (double)Behaviour.travelling.from.y);
+	QWaitTypes::Coords position;
 
-	Behaviour.location.x = newx;
-	Behaviour.location.y = newy;
+	position.x = static_cast<int>(progress * ((double)Behaviour.travelling.to.x - (double)Behaviour.travelling.from.x) + (double)Behaviour.travelling.from.x);
+	position.y = static_cast<int>(progress * ((double)Behaviour.travelling.to.y - (double)Behaviour.travelling.from.y) + (double)Behaviour.travelling.from.y);
+
+	return position;
 }
 
 
@@ -1037,12 +1068,11 @@ void Group::SaveMinuteStats()
 {
 	GroupMinuteDataVI m;
 
-	m.position.x = Behaviour.location.x;
-	m.position.y = Behaviour.location.y;
+	m.position = GetLocation();
 
-	m.parkStatus = Behaviour.parkStatus;
+	m.parkStatus = GetParkStatus();
 
-	switch (Behaviour.parkStatus)
+	switch (m.parkStatus)
 	{
 	case GroupParkStatus::OnWay:
 		m.parkStatusInt = 0;
@@ -1080,10 +1110,4 @@ void Group::SaveMinuteStats()
 	}
 
 	Statistics.minuteLog.push_back(m);
-}
-
-
-std::wstring Group::GetLocationByMinute(int minute)
-{
-	return L"," + std::to_wstring(minute) + L"," + std::to_wstring(Statistics.minuteLog[minute].position.x) + L"," + std::to_wstring(Statistics.minuteLog[minute].position.y) + L"," + std::to_wstring(Statistics.minuteLog[minute].parkStatusInt);
 }
\ No newline at end of file
@@ -13,8 +13,10 @@
 #pragma once
 
 
+#include <random>
 #include <vector>
 
+#include "GroupHotState.h"
 #include "QWaitTypes.h"
 #include "Visitor.h"
 
@@ -63,8 +65,7 @@ struct GroupTravel {
 
 	int toRide = 0;
 	int toEatery = 0;
-	int minutesLeft = 0;
-	int minutesStart = 0;
+	int ticksStart = 0;			// the ticks left are in GroupHotState
 	int fastPass = 0;
 };
 
@@ -86,8 +87,8 @@ struct GroupConfiguration {
 
 	bool stayingOnSite = false;
 
-	QWaitTypes::Time arrivalTime = { 0, 0 };
-	QWaitTypes::Time departureTime = { 0, 0 };
+	QWaitTypes::Time arrivalTime = 0;
+	QWaitTypes::Time departureTime = 0;
 
 	std::wstring GetTypeToString()
 	{
@@ -152,10 +153,8 @@ struct GroupStatistics {
 struct Consumption
 {
 	double Food = 0;
-	double Drink = 0;
 
 	int TimeSinceFood = 0;
-	int TimeSinceDrink = 0;
 
 	double Threshold = 1000;
 };
@@ -168,39 +167,29 @@ struct ParkBehaviour
 	int currentRide = Constants::kNoSelectedRide;
 	int currentEatery = Constants::kNoSelectedEatery;
 
-	GroupParkStatus parkStatus = GroupParkStatus::OnWay;
-
-	int waitingTime = 0;      // minutes to wait
-
 	GroupTravel travelling;
 
-	QWaitTypes::Coords location;
+	QWaitTypes::Coords location;	// while travelling this is where the journey started; see GetLocation()
 
 	int maximumRideWaitingTime = 0;
 };
 
 
-struct GroupRiding
-{
-	int timeLeft = 0;     // minutes left on the current ride
-};
-
-
 class Group
 {
 	void Demographics();
 
-	void SetGroupSettings();
+	void SetGroupSettings(std::mt19937&);
 
-	void BuildFamily(double);
-	void BuildAdultCouple(double);
-	void BuildAdultGroup(double);
-	void BuildSingle(double);
+	void BuildFamily(double, std::mt19937&);
+	void BuildAdultCouple(double, std::mt19937&);
+	void BuildAdultGroup(double, std::mt19937&);
+	void BuildSingle(double, std::mt19937&);
 
 	VisitorType GetType(double);
 
-	NewVisitorConfiguration GetVisitorGenericAdult();
-	NewVisitorConfiguration GetVisitorGenericChild();
+	NewVisitorConfiguration GetVisitorGenericAdult(std::mt19937&);
+	NewVisitorConfiguration GetVisitorGenericChild(std::mt19937&);
 
 	NewVisitorConfiguration GetBaseVisitorConfiguration(VisitorType);
 
@@ -224,12 +213,13 @@ public:
 
 	GroupConfiguration Configuration;
 
-	GroupRiding Riding;
+	GroupHotState* Hot = nullptr;	// park status, countdowns and drink level live here once the simulation starts
+	int ID = 0;						// index in to Hot (and VisitorController::Groups)
 	
-	Group(GroupType, int);
+	Group(GroupType, int, std::mt19937&);
 	Group(int, int, int, bool, int, int, int, int);
 
-	bool CreateVisitorFromFileData(const std::wstring);
+	void VisitorsLoaded();
 
 	int GroupRemovedFromRide(int, RideExitType);
 	int GroupRemovedFromRideShutdown(RideExitType);
@@ -241,7 +231,7 @@ public:
 
 	void SetRiding(QWaitTypes::Riders, int, int, bool);
 	void SetNewRide(int, int, int, int, QWaitTypes::Coords);
-	void SetTravellingMinutesLeft(int, bool);
+	void SetTravellingTicksLeft(int, bool);
 	void SetAtRideQueuing(int);
 	void SetAtRideQueuingFastPass(int);
 
@@ -250,20 +240,22 @@ public:
 
 	void UpdateLastRidesList();
 
+	GroupParkStatus GetParkStatus();
+
 	void SetStatusForAllVisitors(GroupParkStatus, VisitorParkStatus);
 
+	void FlushStatusMinutes();
+
 	int GetMaximumWaitingTime();
 	int GetMaximumWaitingTimeFood();
 
 	void UpdateLocation(int, int);
-	void UpdateTravellingLocation(void);
+	QWaitTypes::Coords GetLocation();
 
 	void SetStatForAllVisitors(GroupVisitorStat);
 
 	void SaveMinuteStats();
 
-	std::wstring GetLocationByMinute(int);
-
 	void SetWaiting(int);
 
 	void AddFastPassTicket(int, int, QWaitTypes::Time);
@@ -275,5 +267,4 @@ public:
 
 	void ResetFoodDrink();
 	void SetAtEateryQueuing(int);
-	void UpdateConsumption(int);
 };
\ No newline at end of file
@@ -0,0 +1,172 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include "Group.h"
+#include "GroupHotState.h"
+
+
+namespace
+{
+	const int32_t kOnWay = static_cast<int32_t>(GroupParkStatus::OnWay);
+	const int32_t kAtEntrance = static_cast<int32_t>(GroupParkStatus::AtEntrance);
+	const int32_t kIdle = static_cast<int32_t>(GroupParkStatus::Idle);
+	const int32_t kRiding = static_cast<int32_t>(GroupParkStatus::Riding);
+	const int32_t kQueuing = static_cast<int32_t>(GroupParkStatus::Queuing);
+	const int32_t kQueuingFastPass = static_cast<int32_t>(GroupParkStatus::QueuingFastPass);
+	const int32_t kQueuingFood = static_cast<int32_t>(GroupParkStatus::QueuingFood);
+	const int32_t kTravellingRide = static_cast<int32_t>(GroupParkStatus::TravellingRide);
+	const int32_t kWaiting = static_cast<int32_t>(GroupParkStatus::Waiting);
+	const int32_t kTravellingFood = static_cast<int32_t>(GroupParkStatus::TravellingFood);
+	const int32_t kEating = static_cast<int32_t>(GroupParkStatus::Eating);
+
+	// drink consumption rate by GroupParkStatus; 0 for the states where it doesn't change
+	const double kConsumptionModifier[12] = { 0.0, 0.0, 0.3, 0.9, 0.6, 0.6, 0.0, 1.0, 0.3, 1.0, 0.0, 0.0 };
+
+	// 0^2 + 1^2 + ... + n^2
+	int64_t SumOfSquares(int64_t n)
+	{
+		if (n <= 0)
+		{
+			return 0;
+		}
+
+		return n * (n + 1) * (2 * n + 1) / 6;
+	}
+}
+
+
+// called once the population is complete; the Groups must not be moved after this
+void GroupHotState::Attach(std::vector<Group>& groups)
+{
+	size_t count = groups.size();
+
+	Status.assign(count, kOnWay);
+	RideTimeLeft.assign(count, 0);
+	TravelTicksLeft.assign(count, 0);
+	WaitingTime.assign(count, 0);
+	PendingTicks.assign(count, 0);
+	ArrivalMinute.resize(count);
+	DepartureFirstMinute.resize(count);
+	DepartureLastMinute.resize(count);
+	DrinkBase.assign(count, 0.0);
+	DrinkResetMinute.assign(count, 0);
+	SegmentStartMinute.assign(count, 0);
+	Ready.assign(count, 0);
+
+	ConsumptionMinute = 0;
+
+	for (int g = 0; g < count; g++)
+	{
+		groups[g].Hot = this;
+		groups[g].ID = g;
+
+		ArrivalMinute[g] = groups[g].Configuration.arrivalTime;
+
+		DepartureFirstMinute[g] = groups[g].Configuration.departureTime;
+		DepartureLastMinute[g] = QWaitTypes::MakeTime(QWaitTypes::Hour(groups[g].Configuration.departureTime), 59);
+	}
+}
+
+
+// one tick of every group: running rides, journeys and waits count down, and the tick is added to the
+// group's pending time for its status. groups that have arrived, finished a countdown, are due to leave,
+// or are idle/at the entrance are flagged in Ready for the engine's per-group code
+void GroupHotState::Advance(int minute, bool park_open)
+{
+	const int32_t now = minute;
+	const int32_t closed = park_open ? 0 : 1;
+
+	const size_t count = Status.size();
+
+	const int32_t* status = Status.data();
+	const int32_t* arrival = ArrivalMinute.data();
+	const int32_t* departure_first = DepartureFirstMinute.data();
+	const int32_t* departure_last = DepartureLastMinute.data();
+
+	int32_t* ride_left = RideTimeLeft.data();
+	int32_t* travel_left = TravelTicksLeft.data();
+	int32_t* waiting = WaitingTime.data();
+	int32_t* pending = PendingTicks.data();
+	int32_t* ready = Ready.data();
+
+	for (size_t g = 0; g < count; g++)
+	{
+		const int32_t s = status[g];
+
+		const int32_t riding = s == kRiding;
+		const int32_t travelling = (s == kTravellingRide) | (s == kTravellingFood);
+		const int32_t waiting_or_eating = (s == kWaiting) | (s == kEating);
+		const int32_t idle_or_waiting = waiting_or_eating | (s == kIdle);
+		const int32_t queuing = (s == kQueuing) | (s == kQueuingFastPass) | (s == kQueuingFood);
+
+		const int32_t leaving = ((now >= departure_first[g]) & (now <= departure_last[g])) | closed;
+
+		const int32_t ride_counting = riding & (ride_left[g] != 0);
+		const int32_t travel_counting = travelling & (travel_left[g] != 0);
+		const int32_t wait_counting = idle_or_waiting & (waiting[g] != 0) & (leaving ^ 1);
+
+		ride_left[g] -= ride_counting;
+		travel_left[g] -= travel_counting;
+		waiting[g] -= wait_counting;
+
+		pending[g] += ride_counting | travel_counting | (wait_counting & waiting_or_eating) | queuing;
+
+		ready[g] = ((s == kOnWay) & (arrival[g] == now)) | (s == kAtEntrance) |
+			       (riding & (ride_counting ^ 1)) | (travelling & (travel_counting ^ 1)) | (idle_or_waiting & (wait_counting ^ 1));
+	}
+}
+
+
+// a group leaves from its departure time until the end of that hour
+bool GroupHotState::IsDeparting(int group, int minute)
+{
+	return minute >= DepartureFirstMinute[group] && minute <= DepartureLastMinute[group];
+}
+
+
+// all status changes go through here so the drink segment can be closed with the old status's modifier
+void GroupHotState::SetStatus(int group, GroupParkStatus status)
+{
+	if (TrackDrink)
+	{
+		DrinkBase[group] = GetDrink(group);
+		SegmentStartMinute[group] = ConsumptionMinute;
+	}
+
+	Status[group] = static_cast<int32_t>(status);
+}
+
+
+void GroupHotState::StartConsumption(int temperature)
+{
+	TrackDrink = true;
+
+	ConsumptionRate = 0.3333 * 0.3333 * (double)temperature;
+}
+
+
+// drink level at the start of this minute's food/drink step
+double GroupHotState::GetDrink(int group)
+{
+	int64_t first = SegmentStartMinute[group] - DrinkResetMinute[group];
+	int64_t last = ConsumptionMinute - DrinkResetMinute[group];
+
+	return DrinkBase[group] + kConsumptionModifier[Status[group]] * ConsumptionRate * (double)(SumOfSquares(last - 1) - SumOfSquares(first - 1));
+}
+
+
+void GroupHotState::ResetDrink(int group)
+{
+	DrinkBase[group] = 0.0;
+	DrinkResetMinute[group] = ConsumptionMinute;
+	SegmentStartMinute[group] = ConsumptionMinute;
+}
\ No newline at end of file
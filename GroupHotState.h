@@ -0,0 +1,74 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+#include <cstdint>
+#include <vector>
+
+
+class Group;
+
+enum class GroupParkStatus;
+
+
+// the group values that change every tick, kept as one array per field (indexed by group id) rather
+// than inside each Group. the engine runs the countdowns and the time-spent counting as a straight loop
+// over these arrays, and only the groups flagged in Ready go through the per-group decision code. the
+// loop is written without branches so the compiler can vectorise it
+//
+// the countdowns are in engine ticks (one a minute unless the tick is set shorter); everything a group
+// does still takes whole minutes, the ticks only decide when within a minute it starts and ends
+//
+// drink is never stepped per minute: while a group's status doesn't change its drink level grows by
+// rate x modifier x t^2 per minute (t = minutes since the last drink), so the sum over any run of
+// minutes has a closed form. each status change closes the running segment in to DrinkBase
+class GroupHotState
+{
+public:
+
+	std::vector<int32_t> Status;				// GroupParkStatus
+	std::vector<int32_t> RideTimeLeft;			// ticks left on the current ride
+	std::vector<int32_t> TravelTicksLeft;
+	std::vector<int32_t> WaitingTime;			// ticks to wait; idle groups that found nothing to do wait for the next minute
+
+	std::vector<int32_t> PendingTicks;			// ticks in the current status not yet added to the visitors' stats
+
+	std::vector<int32_t> ArrivalMinute;			// minute of the day
+	std::vector<int32_t> DepartureFirstMinute;	// waiting/eating groups leave between these two minutes of the day
+	std::vector<int32_t> DepartureLastMinute;
+
+	int TicksPerMinute = 1;
+
+	bool TrackDrink = false;					// only with food/drink on (StartConsumption())
+	int ConsumptionMinute = 0;					// food/drink minutes run so far
+	double ConsumptionRate = 0.0;				// 0.3333^2 x temperature
+
+	std::vector<double> DrinkBase;				// drink level when the current status began
+	std::vector<int32_t> DrinkResetMinute;		// ConsumptionMinute of the last drink
+	std::vector<int32_t> SegmentStartMinute;	// ConsumptionMinute the current status began
+
+	std::vector<int32_t> Ready;					// 1 = group needs a decision this minute
+
+	void Attach(std::vector<Group>&);
+
+	void Advance(int, bool);
+
+	bool IsDeparting(int, int);
+
+	void SetStatus(int, GroupParkStatus);
+
+	void StartConsumption(int);
+	double GetDrink(int);
+	void ResetDrink(int);
+};
\ No newline at end of file
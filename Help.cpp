@@ -36,6 +36,12 @@ namespace Help
         std::wcout << L"                                    5 : Coin-op arcade\n";
         std::wcout << L"                                    6 : Alton Towers UK\n";
         std::wcout << L"    /UseConfigFile;filename     set configuration from specified config file.\n";
+        std::wcout << L"    /CompileTemplate;filename   build the park from /Template or /TemplateFile and\n";
+        std::wcout << L"                                save it as a binary park image (.qwpark), then exit.\n";
+        std::wcout << L"                                load it with /TemplateFile;filename.qwpark\n";
+        std::wcout << L"    /ParkCache;folder           keep the walk/closest ride data built from the park\n";
+        std::wcout << L"                                in folder (default current), reused while the\n";
+        std::wcout << L"                                park is unchanged.\n";
         std::wcout << "\n";
         std::wcout << L"    /ImportVisitorDemo;filename rather than generating random visitors, the data from.\n";
         std::wcout << L"                                the specified file is used. Companion of /ReportVisitorDemo.\n";
@@ -43,6 +49,12 @@ namespace Help
         std::wcout << "\n";
         std::wcout << L"    /FoodDrink                  enabled visitors' food/drink requirements.\n";
         std::wcout << "\n";
+        std::wcout << L"    /TickSeconds;x              length of each simulation step in seconds, must\n";
+        std::wcout << L"                                divide 60. default is 60 (one minute). shorter\n";
+        std::wcout << L"                                steps spread ride/entrance capacity over the minute.\n";
+        std::wcout << L"    /Benchmark                  time each built-in park at 60, 30, 15 and 10 second\n";
+        std::wcout << L"                                steps, then exit. uses /Visitors;x\n";
+        std::wcout << "\n";
         std::wcout << L"    /DebugSCC                   export selection choice cache.\n";
         std::wcout << L"                                this is the data used by the visitor types to pick rides.\n";
         std::wcout << L"    /DebugDistanceCache         export the time and distance caches to a csv file.\n";
@@ -50,8 +62,13 @@ namespace Help
         std::wcout << L"    /DebugNoExecute             everything except running the model.\n";
         std::wcout << L"    /DebugUpdateRate;x          updated statistics every x minutes to the console.\n";
         std::wcout << L"                                default is 15\n";
+        std::wcout << L"    /Profile                    time each stage of the run (startup, each part\n";
+        std::wcout << L"                                of the day, each report), show the breakdown and\n";
+        std::wcout << L"                                save it as a csv file.\n";
         std::wcout << "\n";
         std::wcout << L"    /ReportHTML;filename        export HTML simulation summary report.\n";
+        std::wcout << L"    /HTMLCompact                much smaller HTML report, drawn by the browser\n";
+        std::wcout << L"                                from embedded data (charts for minute-by-minute).\n";
         std::wcout << "\n";
         std::wcout << L"    /ReportCVD                  export complete visitor data.\n";
         std::wcout << L"    /ReportCSVmxm               export a minute-by-minute report in CSV format.\n";
@@ -63,9 +80,16 @@ namespace Help
         std::wcout << L"                                very large output: ~280MB per 20000 visitors!\n";
         std::wcout << L"    /ReportVisitorDemo;filename export visitor demographics (useful if you want\n";
         std::wcout << L"                                to maintain a consistent set of visitors across\n";
-        std::wcout << L"                                multuple runs).\n";
+        std::wcout << L"                                multuple runs). Use a .qwp file name for the\n";
+        std::wcout << L"                                binary format, which reloads much faster.\n";
         std::wcout << L"    /ReportVisitorRideList      export complete list of visitors and the rides\n";
         std::wcout << L"                                ridden today (csv).\n";
+        std::wcout << L"    /ReportCompress             gzip the visitor, location, ride list and\n";
+        std::wcout << L"                                minute-by-minute csv reports (.csv.gz).\n";
+        std::wcout << L"    /EncodeNames                ride list report writes each ride name once,\n";
+        std::wcout << L"                                then ride indices per visitor.\n";
+        std::wcout << L"    /ExpandList;filename        convert an /EncodeNames list back to names, then\n";
+        std::wcout << L"                                exit (writes filename_expanded.csv).\n";
         std::wcout << std::endl;
 	}
 
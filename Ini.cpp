@@ -10,20 +10,27 @@
 // =======================================================================
 
 
+
+
 #include "Ini.h"
 
 #include <algorithm>
-#include <codecvt>
+#include <charconv>
+#include <cwctype>
 #include <fstream>
 #include <iostream>
-#include <locale>
+#include <iterator>
 #include <string>
-#include <vector>
 
 
 Ini::Ini(const std::wstring file_name)
 {
 	Loaded = LoadFile(file_name);
+
+	if (Loaded)
+	{
+		BuildIndex();
+	}
 }
 
 
@@ -33,136 +40,197 @@ bool Ini::LoadFile(const std::wstring file_name)
 
 	if (file)
 	{
-		Lines.clear();
+		Buffer.assign(std::istreambuf_iterator<wchar_t>(file), std::istreambuf_iterator<wchar_t>());
+
+		file.close();
+
+		return true;
+	}
+
+	return false;
+}
+
+
+void Ini::BuildIndex()
+{
+	std::unordered_map<std::wstring_view, std::wstring_view>* current = nullptr;
+
+	std::wstring_view text(Buffer);
+
+	size_t start = 0;
+
+	while (start < text.size())
+	{
+		size_t end = text.find(L'\n', start);
+
+		if (end == std::wstring_view::npos)
+		{
+			end = text.size();
+		}
+
+		std::wstring_view line = text.substr(start, end - start);
+
+		start = end + 1;
+
+		if (line.empty())
+		{
+			continue;
+		}
+
+		if (line[0] == L'[')
+		{
+			size_t bc = line.find(L']');
+
+			std::wstring name(line.substr(1, bc == std::wstring_view::npos ? std::wstring_view::npos : bc - 1));
 
-		std::wstring s;
+			std::transform(name.begin(), name.end(), name.begin(), ::tolower);
 
-		while (std::getline(file, s))
+			// a repeated section is ignored
+			auto added = Sections.try_emplace(name);
+
+			current = added.second ? &added.first->second : nullptr;
+		}
+		else if (current != nullptr && line[0] != L';' && line[0] != L'/')
 		{
-			if (s != L"")
+			size_t equals = line.find(L'=');
+
+			if (equals != std::wstring_view::npos)
 			{
-				Lines.push_back(s);
+				current->try_emplace(line.substr(0, equals), line.substr(equals + 1));
 			}
 		}
+	}
+}
 
-		file.close();
 
-		return true;
+// true if the key is present with a value
+bool Ini::Find(std::wstring section, const std::wstring key, std::wstring_view& value)
+{
+	std::transform(section.begin(), section.end(), section.begin(), ::tolower);
+
+	auto s = Sections.find(section);
+
+	if (s != Sections.end())
+	{
+		auto k = s->second.find(key);
+
+		if (k != s->second.end() && !k->second.empty())
+		{
+			value = k->second;
+
+			return true;
+		}
 	}
 
 	return false;
 }
 
 
-int Ini::ReadInteger(const std::wstring section, const std::wstring key, int default_value)
+// like stoi: leading white space and a sign are allowed, anything after the number is ignored
+bool Ini::ParseInteger(std::wstring_view input, int& value)
 {
-	try
+	size_t i = 0;
+
+	while (i < input.size() && iswspace(input[i]))
 	{
-		int i = std::stoi(ReadString(section, key, L"-1"));
+		i++;
+	}
+
+	char digits[16];
+	size_t count = 0;
 
-		if (i == -1)
+	if (i < input.size() && (input[i] == L'+' || input[i] == L'-'))
+	{
+		if (input[i] == L'-')
 		{
-			return default_value;
+			digits[count++] = '-';
 		}
 
-		return i;
+		i++;
 	}
-	catch(...)
+
+	while (i < input.size() && count < sizeof(digits) && input[i] >= L'0' && input[i] <= L'9')
 	{
-		std::wcerr << L"Invalid integer parameter \"" << key << L"\" in [" << section << L"]." << section << std::endl;
+		digits[count++] = static_cast<char>(input[i++]);
+	}
 
-		return default_value;
+	if (i < input.size() && input[i] >= L'0' && input[i] <= L'9')
+	{
+		return false;	// too many digits for an int
 	}
+
+	std::from_chars_result result = std::from_chars(digits, digits + count, value);
+
+	return result.ec == std::errc() && result.ptr == digits + count;
 }
 
 
-bool Ini::ReadBoolean(const std::wstring section, const std::wstring key, bool default_value)
+int Ini::ReadInteger(const std::wstring section, const std::wstring key, int default_value)
 {
-	try
+	std::wstring_view value;
+
+	if (!Find(section, key, value))
 	{
-		int i = std::stoi(ReadString(section, key, L"-1"));
+		return default_value;
+	}
 
-		if (i == -1)
-		{
-			return default_value;
-		}
-		else if (i == 0)
-		{
-			return false;
-		}
+	int i = 0;
 
-		return true;
-	}
-	catch (...)
+	if (!ParseInteger(value, i))
 	{
-		std::wcerr << L"Invalid boolean parameter \"" << key << L"\" in [" << section << L"]." << section << std::endl;
+		std::wcerr << L"Invalid integer parameter \"" << key << L"\" in [" << section << L"]." << section << std::endl;
 
 		return default_value;
 	}
+
+	if (i == -1)
+	{
+		return default_value;
+	}
+
+	return i;
 }
 
 
-std::wstring Ini::ReadString(std::wstring section, std::wstring key, const std::wstring default_value)
+bool Ini::ReadBoolean(const std::wstring section, const std::wstring key, bool default_value)
 {
-	bool inSection = false;
-	std::wstring sectionName = L"";
+	std::wstring_view value;
+
+	if (!Find(section, key, value))
+	{
+		return default_value;
+	}
 
-	key = key + L'=';
+	int i = 0;
 
-	std::transform(section.begin(), section.end(), section.begin(), ::tolower);
+	if (!ParseInteger(value, i))
+	{
+		std::wcerr << L"Invalid boolean parameter \"" << key << L"\" in [" << section << L"]." << section << std::endl;
+
+		return default_value;
+	}
 
-	for (int i = 0; i < Lines.size(); i++)
+	if (i == -1)
 	{
-		if (Lines[i][0] == '[')
-		{
-			if (inSection)
-			{
-				// we were in the right section, but now entered a new one.... which means the key we're looking
-				// for must be missing, so return the default value
+		return default_value;
+	}
+	else if (i == 0)
+	{
+		return false;
+	}
 
-				return default_value;
-			}
-			else
-			{
-				std::size_t bo = Lines[i].find(L"[");
-				std::size_t bc = Lines[i].find(L"]");
+	return true;
+}
 
-				sectionName = Lines[i].substr(bo + 1, bc - 1);
 
-				std::transform(sectionName.begin(), sectionName.end(), sectionName.begin(), ::tolower);
+std::wstring Ini::ReadString(std::wstring section, std::wstring key, const std::wstring default_value)
+{
+	std::wstring_view value;
 
-				if (sectionName == section)
-				{
-					inSection = true;
-				}
-			}
-		}
-		else
-		{
-			if (inSection)
-			{
-				if (Lines[i] != L"")
-				{
-					if ((Lines[i][0] != L';') && (Lines[i][0] != L'/'))
-					{
-						if (Lines[i].find(key) == 0)
-						{
-							if (Lines[i].length() > key.length())
-							{
-								return Lines[i].substr(key.length());
-							}
-							else
-							{
-								// key is emtpy (key= ) so let's return the default                                
-
-								return default_value;
-							}
-						}
-					}
-				}
-			}
-		}
+	if (Find(section, key, value))
+	{
+		return std::wstring(value);
 	}
 
 	return default_value;
-}
\ No newline at end of file
+}
@@ -10,26 +10,42 @@
 // =======================================================================
 
 
+
+
 #pragma once
 
 
 #include <string>
-#include <vector>
+#include <string_view>
+#include <unordered_map>
 
 
+// the file is read once and indexed by section (case insensitive) and key; values are views in to the
+// file's text. as before, only the first section of a name is used, the first of a key within it wins,
+// and an empty value (key=) reads as the default
 class Ini
 {
 private:
+	std::wstring Buffer;
+
+	std::unordered_map<std::wstring, std::unordered_map<std::wstring_view, std::wstring_view>> Sections;
+
 	bool LoadFile(const std::wstring);
+	void BuildIndex();
+
+	bool Find(std::wstring, const std::wstring, std::wstring_view&);
+
+	bool ParseInteger(std::wstring_view, int&);
 
 public:
 
 	bool Loaded;
 
-	std::vector<std::wstring> Lines;
-
 	Ini(const std::wstring);
 
+	Ini(const Ini&) = delete;
+	Ini& operator=(const Ini&) = delete;
+
 	bool ReadBoolean(const std::wstring, const std::wstring, bool);
 	int ReadInteger(const std::wstring, const std::wstring key, int);
 	std::wstring ReadString(std::wstring, std::wstring, const std::wstring);
@@ -0,0 +1,99 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include <string>
+#include <Windows.h>
+
+#include "MappedFile.h"
+
+
+MappedFile::MappedFile(const std::wstring file_name)
+{
+	HANDLE file = CreateFileW(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+
+	FileHandle = file;
+
+	LARGE_INTEGER size;
+
+	if (!GetFileSizeEx(file, &size))
+	{
+		return;
+	}
+
+	ViewSize = static_cast<size_t>(size.QuadPart);
+
+	// an empty file can't be mapped, but is still a valid (empty) view
+	if (ViewSize == 0)
+	{
+		return;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (mapping == nullptr)
+	{
+		ViewSize = 0;
+
+		return;
+	}
+
+	MappingHandle = mapping;
+
+	View = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+
+	if (View == nullptr)
+	{
+		ViewSize = 0;
+	}
+}
+
+
+MappedFile::~MappedFile()
+{
+	if (View != nullptr)
+	{
+		UnmapViewOfFile(View);
+	}
+
+	if (MappingHandle != nullptr)
+	{
+		CloseHandle(MappingHandle);
+	}
+
+	if (FileHandle != nullptr)
+	{
+		CloseHandle(FileHandle);
+	}
+}
+
+
+bool MappedFile::IsOpen() const
+{
+	return FileHandle != nullptr && (View != nullptr || ViewSize == 0);
+}
+
+
+const char* MappedFile::Data() const
+{
+	return View;
+}
+
+
+size_t MappedFile::Size() const
+{
+	return ViewSize;
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+#include <string>
+
+
+// read-only view of a whole file, mapped in to memory rather than read through a stream.
+// the data is not null terminated
+class MappedFile
+{
+	void* FileHandle = nullptr;
+	void* MappingHandle = nullptr;
+
+	const char* View = nullptr;
+	size_t ViewSize = 0;
+
+public:
+
+	MappedFile(const std::wstring);
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool IsOpen() const;
+
+	const char* Data() const;
+	size_t Size() const;
+};
\ No newline at end of file
@@ -18,68 +18,90 @@
 
 Names::Names()
 {
-	LoadNames();
 }
 
 
 void Names::LoadNames()
 {
-	std::wifstream file(L"firstnames.txt");
+	LoadList(L"firstnames.txt", FirstName);
+
+	LoadFirstNames = FirstName.size() != 0;
+
+	LoadList(L"surnames.txt", LastName);
+
+	LoadLastNames = LastName.size() != 0;
+}
+
+
+void Names::LoadList(const std::wstring file_name, std::vector<std::wstring>& list)
+{
+	std::wifstream file(file_name);
 
 	if (file)
 	{
 		std::wstring s;
 
-		std::wcout << L"Loading \"firstnames.txt\"..." << std::endl;
+		std::wcout << L"Loading \"" << file_name << L"\"..." << std::endl;
 
-		while (std::getline(file, s))
+		while (std::getline(file, s) && list.size() < kNoName)
 		{
 			if (s != L"")
 			{
-				FirstName.push_back(s);
+				list.push_back(s);
 			}
 		}
 
 		file.close();
-
-		LoadFirstNames = true;
 	}
 	else
 	{
-		std::wcout << L"Error loading \"firstnames.txt\"." << std::endl;
+		std::wcout << L"Error loading \"" << file_name << L"\"." << std::endl;
 	}
+}
 
-	std::wifstream file2(L"surnames.txt");
 
-	if (file2)
-	{
-		std::wstring s;
+// tables that came with a population loaded from file
+void Names::SetNames(std::vector<std::wstring>&& first_names, std::vector<std::wstring>&& last_names)
+{
+	FirstName = std::move(first_names);
+	LastName = std::move(last_names);
 
-		std::wcout << L"Loading \"surnames.txt\"..." << std::endl;
+	LoadFirstNames = FirstName.size() != 0;
+	LoadLastNames = LastName.size() != 0;
+}
 
-		while (std::getline(file2, s))
-		{
-			if (s != L"")
-			{
-				LastName.push_back(s);
-			}
-		}
 
-		file2.close();
+bool Names::Available()
+{
+	return LoadFirstNames && LoadLastNames;
+}
 
-		LoadLastNames = true;
-	}
-	else
+
+void Names::GetRandomName(std::mt19937& generator, uint16_t& first, uint16_t& last)
+{
+	first = static_cast<uint16_t>(std::uniform_int_distribution<int>(0, static_cast<int>(FirstName.size()) - 1)(generator));
+	last = static_cast<uint16_t>(std::uniform_int_distribution<int>(0, static_cast<int>(LastName.size()) - 1)(generator));
+}
+
+
+std::wstring Names::GetName(uint16_t first, uint16_t last)
+{
+	if (first >= FirstName.size() || last >= LastName.size())
 	{
-		std::wcout << L"Error loading \"surnames.txt\"." << std::endl;
+		return L"";
 	}
+
+	return FirstName[first] + L" " + LastName[last];
 }
 
 
-std::wstring Names::GetRandomName()
+const std::vector<std::wstring>& Names::FirstNames()
 {
-	int first = rand() % FirstName.size();
-	int last = rand() % LastName.size();
+	return FirstName;
+}
 
-	return FirstName[first] + L" " + LastName[last];
+
+const std::vector<std::wstring>& Names::LastNames()
+{
+	return LastName;
 }
\ No newline at end of file
@@ -13,16 +13,23 @@
 #pragma once
 
 
+#include <cstdint>
+#include <random>
 #include <string>
 #include <vector>
 
 
+static const uint16_t kNoName = 0xFFFF;		// visitor has no name; also limits each table to 65535 names
+
+
+// interned first name and surname tables. visitors hold an index in to each,
+// the full name is only built when a report writes it
 class Names
 {
 	std::vector<std::wstring> FirstName;
 	std::vector<std::wstring> LastName;
 
-	void LoadNames();
+	void LoadList(const std::wstring, std::vector<std::wstring>&);
 
 public:
 
@@ -31,5 +38,14 @@ public:
 
 	Names();
 
-	std::wstring GetRandomName();
+	void LoadNames();
+	void SetNames(std::vector<std::wstring>&&, std::vector<std::wstring>&&);
+
+	bool Available();
+
+	void GetRandomName(std::mt19937&, uint16_t&, uint16_t&);
+	std::wstring GetName(uint16_t, uint16_t);
+
+	const std::vector<std::wstring>& FirstNames();
+	const std::vector<std::wstring>& LastNames();
 };
\ No newline at end of file
@@ -0,0 +1,209 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "MappedFile.h"
+#include "ParkCacheFile.h"
+
+
+namespace
+{
+	uint64_t Align(uint64_t offset)
+	{
+		return (offset + kDistanceMatrixAlignment - 1) & ~static_cast<uint64_t>(kDistanceMatrixAlignment - 1);
+	}
+
+
+	void WritePadding(std::ofstream& file, uint64_t written)
+	{
+		static const char zeroes[kDistanceMatrixAlignment] = { 0 };
+
+		file.write(zeroes, Align(written) - written);
+	}
+}
+
+
+void ParkFingerprint::Add(const void* data, size_t size)
+{
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+	for (size_t i = 0; i < size; i++)
+	{
+		Value ^= bytes[i];
+		Value *= 1099511628211ull;
+	}
+}
+
+
+void ParkFingerprint::Add(int value)
+{
+	int32_t v = value;
+
+	Add(&v, sizeof(v));
+}
+
+
+// length first, so "ab" + "c" and "a" + "bc" differ
+void ParkFingerprint::Add(const std::wstring value)
+{
+	Add(static_cast<int>(value.size()));
+
+	for (int c = 0; c < value.size(); c++)
+	{
+		Add(static_cast<int>(value[c]));
+	}
+}
+
+
+uint64_t ParkFingerprint::Get() const
+{
+	return Value;
+}
+
+
+namespace ParkCacheFile
+{
+	std::wstring GetFileName(const std::wstring folder, uint64_t fingerprint)
+	{
+		std::wostringstream name;
+
+		name << std::hex << std::setw(16) << std::setfill(L'0') << fingerprint << kParkCacheFileExtension;
+
+		return (std::filesystem::path(folder) / name.str()).wstring();
+	}
+
+
+	// header | walk cache | closest rides (int32, ride x ClosestCount) | fastpass lists (int32), each part 64 byte aligned
+	bool Save(const std::wstring file_name, uint64_t fingerprint, const DistanceMatrix& walk, const std::vector<Ride>& rides, const std::vector<int> fast_pass[3])
+	{
+		std::ofstream file(std::filesystem::path(file_name), std::ios::binary);
+
+		if (!file)
+		{
+			std::wcerr << L"Unable to save park cache file \"" << file_name << L"\"." << std::endl;
+
+			return false;
+		}
+
+		ParkCacheFileHeader header;
+
+		memcpy(header.Magic, kParkCacheFileMagic, sizeof(header.Magic));
+
+		header.Fingerprint = fingerprint;
+		header.LocationCount = walk.GetSize();
+		header.ClosestCount = kClosestCacheSize;
+		header.WalkBytes = walk.GetByteCount();
+
+		for (int f = 0; f < 3; f++)
+		{
+			header.FastPassCount[f] = static_cast<uint32_t>(fast_pass[f].size());
+		}
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		WritePadding(file, sizeof(header));
+
+		file.write(reinterpret_cast<const char*>(walk.Data()), walk.GetByteCount());
+		WritePadding(file, walk.GetByteCount());
+
+		std::vector<int32_t> closest;
+
+		for (int r = 0; r < rides.size(); r++)
+		{
+			closest.insert(closest.end(), rides[r].ClosestCache, rides[r].ClosestCache + kClosestCacheSize);
+		}
+
+		file.write(reinterpret_cast<const char*>(closest.data()), closest.size() * sizeof(int32_t));
+		WritePadding(file, closest.size() * sizeof(int32_t));
+
+		for (int f = 0; f < 3; f++)
+		{
+			std::vector<int32_t> list(fast_pass[f].begin(), fast_pass[f].end());
+
+			file.write(reinterpret_cast<const char*>(list.data()), list.size() * sizeof(int32_t));
+		}
+
+		return file.good();
+	}
+
+
+	// false (quietly) if there's no cache for this fingerprint; the caller builds the data instead
+	bool Load(const std::wstring file_name, uint64_t fingerprint, DistanceMatrix& walk, std::vector<Ride>& rides, std::vector<int> fast_pass[3])
+	{
+		if (!std::filesystem::exists(std::filesystem::path(file_name)))
+		{
+			return false;
+		}
+
+		MappedFile file(file_name);
+
+		ParkCacheFileHeader header;
+
+		if (!file.IsOpen() || file.Size() < sizeof(header))
+		{
+			return false;
+		}
+
+		memcpy(&header, file.Data(), sizeof(header));
+
+		if (memcmp(header.Magic, kParkCacheFileMagic, sizeof(header.Magic)) != 0 || header.Version != kParkCacheFileVersion ||
+			header.Fingerprint != fingerprint || header.LocationCount != rides.size() + 1 || header.ClosestCount != kClosestCacheSize)
+		{
+			return false;
+		}
+
+		uint64_t walk_offset = Align(sizeof(header));
+		uint64_t closest_offset = walk_offset + Align(header.WalkBytes);
+		uint64_t fast_pass_offset = closest_offset + Align(rides.size() * kClosestCacheSize * sizeof(int32_t));
+
+		uint64_t size = fast_pass_offset + ((uint64_t)header.FastPassCount[0] + header.FastPassCount[1] + header.FastPassCount[2]) * sizeof(int32_t);
+
+		walk.Resize(header.LocationCount);
+
+		if (file.Size() < size || walk.GetByteCount() != header.WalkBytes)
+		{
+			std::wcerr << L"Park cache file \"" << file_name << L"\" is truncated, rebuilding." << std::endl;
+
+			return false;
+		}
+
+		const char* data = file.Data();
+
+		memcpy(walk.Data(), data + walk_offset, header.WalkBytes);
+
+		const int32_t* closest = reinterpret_cast<const int32_t*>(data + closest_offset);
+
+		for (int r = 0; r < rides.size(); r++)
+		{
+			for (int c = 0; c < kClosestCacheSize; c++)
+			{
+				rides[r].ClosestCache[c] = closest[r * kClosestCacheSize + c];
+			}
+		}
+
+		const int32_t* list = reinterpret_cast<const int32_t*>(data + fast_pass_offset);
+
+		for (int f = 0; f < 3; f++)
+		{
+			fast_pass[f].assign(list, list + header.FastPassCount[f]);
+
+			list += header.FastPassCount[f];
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
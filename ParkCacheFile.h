@@ -0,0 +1,69 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "DistanceMatrix.h"
+#include "Ride.h"
+
+
+static const std::wstring kParkCacheFileExtension = L".qwc";
+
+static const char kParkCacheFileMagic[4] = { 'Q', 'W', 'P', 'C' };
+static const uint32_t kParkCacheFileVersion = 1;
+
+
+// a 64-bit FNV-1a hash of everything the derived park data is built from
+class ParkFingerprint
+{
+	uint64_t Value = 14695981039346656037ull;
+
+public:
+
+	void Add(const void*, size_t);
+	void Add(int);
+	void Add(const std::wstring);
+
+	uint64_t Get() const;
+};
+
+
+struct ParkCacheFileHeader {
+	char Magic[4];
+	uint32_t Version = kParkCacheFileVersion;
+
+	uint64_t Fingerprint = 0;
+
+	uint32_t LocationCount = 0;		// rides + the entrance
+	uint32_t ClosestCount = 0;		// kClosestCacheSize when written
+	uint32_t FastPassCount[3] = { 0, 0, 0 };
+	uint32_t Reserved = 0;
+
+	uint64_t WalkBytes = 0;			// the walk cache, starting at kDistanceMatrixAlignment
+};
+
+
+// the data worked out from a park definition (walk cache, closest rides, fastpass lists), saved under the
+// park's fingerprint so runs of the same park can skip building it. the selection choice cache is drawn
+// at random each run, so it isn't kept
+namespace ParkCacheFile
+{
+	std::wstring GetFileName(const std::wstring, uint64_t);
+
+	bool Save(const std::wstring, uint64_t, const DistanceMatrix&, const std::vector<Ride>&, const std::vector<int>[3]);
+	bool Load(const std::wstring, uint64_t, DistanceMatrix&, std::vector<Ride>&, std::vector<int>[3]);
+}
\ No newline at end of file
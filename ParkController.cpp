@@ -38,10 +38,13 @@
 #include <iostream>
 #include <random>
 
+#include "BuiltInParks.h"
 #include "Configuration.h"
 #include "Constants.h"
 #include "Eatery.h"
 #include "Ini.h"
+#include "ParkCacheFile.h"
+#include "ParkImage.h"
 #include "ParkController.h"
 #include "Ride.h"
 #include "Utility.h"
@@ -60,9 +63,14 @@ bool sortByPopularity(const Ride& r1, const Ride& r2)
 }
 
 
-// results in a list where Rides[0] is the closest (lowest value)
+// equal distances by ride id
 bool sortByDistance(const DistanceInfo& r1, const DistanceInfo& r2)
 {
+	if (r1.distanceTo == r2.distanceTo)
+	{
+		return r1.ride < r2.ride;
+	}
+
 	return r1.distanceTo < r2.distanceTo;
 }
 
@@ -83,15 +91,6 @@ ParkController::ParkController(bool show_config, bool food_drink, const std::wst
 
 	TheoreticalHourThroughputTotal = 0;
 	TheoreticalHourThroughputTotalDay = 0;
-
-	for (int x = 0; x < Constants::MaxRideCount; x++)
-	{
-		for (int y = 0; y < Constants::MaxRideCount; y++)
-		{
-			WalkTimeCache[x][y]     = 0;
-			WalkDistanceCache[x][y] = 0;
-		}
-	}
 }
 
 
@@ -119,18 +118,22 @@ void ParkController::SetEntrance(const std::wstring name, int x, int y, int fast
 
 void ParkController::AddNewRideContinuous(const std::wstring name, int ride_length, RideExitType ride_exit_type, int hourly_throughput, int popularity, int x, int y, int is_fast_pass, int fp_reserve_percent, bool AdultValid, bool ChildValid, bool BabyValid)
 {
+	int park_mode = is_fast_pass;
+
 	if (FastPassMode == FastPassType::None)
 	{ 
 		is_fast_pass = 0;
 	}
 
-	QWaitTypes::Time open = { GConfiguration->ParkOpenTime, 0 };
-	QWaitTypes::Time close = { GConfiguration->ParkCloseTime, 0 };
+	QWaitTypes::Time open = QWaitTypes::MakeTime(GConfiguration->ParkOpenTime, 0);
+	QWaitTypes::Time close = QWaitTypes::MakeTime(GConfiguration->ParkCloseTime, 0);
 
 	int ophours = GConfiguration->ParkOpenHours;
 
 	Ride r(RideType::Continuous, name, ride_length, ride_exit_type, hourly_throughput, popularity, x, y, is_fast_pass, fp_reserve_percent, open, close, ophours, AdultValid, ChildValid);
 
+	r.FastPass.parkMode = park_mode;
+
 	Rides.push_back(r);
 
 	TheoreticalHourThroughputTotal += hourly_throughput;
@@ -139,18 +142,22 @@ void ParkController::AddNewRideContinuous(const std::wstring name, int ride_leng
 
 void ParkController::AddNewRideShow(const std::wstring name, int ride_length, RideExitType ride_exit_type, int StartTimeMinutes, int hourly_throughput, int show_capacity, int popularity, int x, int y, int IsFastPass, int fp_reserve_percent, bool AdultValid, bool ChildValid, bool BabyValid)
 {
+	int park_mode = IsFastPass;
+
 	if (FastPassMode == FastPassType::None)
 	{
 		IsFastPass = 0;
 	}
 
-	QWaitTypes::Time open = { GConfiguration->ParkOpenTime, 0 };
-	QWaitTypes::Time close = { GConfiguration->ParkCloseTime, 0 };
+	QWaitTypes::Time open = QWaitTypes::MakeTime(GConfiguration->ParkOpenTime, 0);
+	QWaitTypes::Time close = QWaitTypes::MakeTime(GConfiguration->ParkCloseTime, 0);
 
 	int ophours = GConfiguration->ParkOpenHours;
 
 	Ride r(RideType::Show, name, ride_length, ride_exit_type, hourly_throughput, popularity, x, y, IsFastPass, fp_reserve_percent, open, close, ophours, AdultValid, ChildValid);
 
+	r.FastPass.parkMode = park_mode;
+
 	r.RideOperation.ShowStartTime = StartTimeMinutes;
 
 	r.ConfigureShowThroughput(show_capacity, fp_reserve_percent);
@@ -163,18 +170,23 @@ void ParkController::AddNewRideShow(const std::wstring name, int ride_length, Ri
 
 void ParkController::AddNewRideContinuousWithHours(const std::wstring name, int ride_length, RideExitType ride_exit_type, int hourly_throughput, int popularity, int open_hour, int open_minute, int close_hour, int close_minute, int x, int y, int is_fast_pass, int fp_reserve_percent, bool AdultValid, bool ChildValid, bool BabyValid)
 {
+	int park_mode = is_fast_pass;
+
 	if (FastPassMode == FastPassType::None)
 	{
 		is_fast_pass = 0;
 	}
 
-	QWaitTypes::Time open = { open_hour, open_minute };
-	QWaitTypes::Time close = { close_hour, close_minute };
+	QWaitTypes::Time open = QWaitTypes::MakeTime(open_hour, open_minute);
+	QWaitTypes::Time close = QWaitTypes::MakeTime(close_hour, close_minute);
 
-	int ophours = Utility::Duration(open, close);
+	int ophours = close - open;
 
 	Ride r(RideType::Continuous, name, ride_length, ride_exit_type, hourly_throughput, popularity, x, y, is_fast_pass, fp_reserve_percent, open, close, ophours, AdultValid, ChildValid);
 
+	r.FastPass.parkMode = park_mode;
+	r.RideOperation.ownHours = true;
+
 	Rides.push_back(r);
 
 	TheoreticalHourThroughputTotal += hourly_throughput;
@@ -183,18 +195,23 @@ void ParkController::AddNewRideContinuousWithHours(const std::wstring name, int
 
 void ParkController::AddNewRideShowWithHours(const std::wstring name, int ride_length, RideExitType ride_exit_type, int start_time_minutes, int hourly_throughput, int show_capacity, int popularity, int open_hour, int open_minute, int close_hour, int close_minute, int x, int y, int is_fast_pass, int fp_reserve_percent, bool AdultValid, bool ChildValid, bool BabyValid)
 {
+	int park_mode = is_fast_pass;
+
 	if (FastPassMode == FastPassType::None)
 	{
 		is_fast_pass = 0;
 	}
 
-	QWaitTypes::Time open = { open_hour, open_minute };
-	QWaitTypes::Time close = { close_hour, close_minute };
+	QWaitTypes::Time open = QWaitTypes::MakeTime(open_hour, open_minute);
+	QWaitTypes::Time close = QWaitTypes::MakeTime(close_hour, close_minute);
 
-	int ophours = Utility::Duration(open, close);
+	int ophours = close - open;
 
 	Ride r(RideType::Show, name, ride_length, ride_exit_type, hourly_throughput, popularity, x, y, is_fast_pass, fp_reserve_percent, open, close, ophours, AdultValid, ChildValid);
 
+	r.FastPass.parkMode = park_mode;
+	r.RideOperation.ownHours = true;
+
 	r.RideOperation.ShowStartTime = start_time_minutes;
 
 	r.ConfigureShowThroughput(show_capacity, fp_reserve_percent);
@@ -215,29 +232,86 @@ void ParkController::AddFoodDrink(const std::wstring name, int throughput, bool
 
 void ParkController::BuildRides(ParkTemplate park_template, const std::wstring file_name)
 {
-	if (file_name != L"")
+	bool derived = false;	// park images and built-in parks are already in popularity order, with the walk cache and closest rides
+
+	if (file_name != L"" && ParkImage::IsParkImage(file_name))
+	{
+		if (!ParkImage::Load(file_name, *this))
+		{
+			std::wcerr << L"Using built-in template " << QWaitTypes::ParkTemplateToInt(park_template) << L" instead." << std::endl;
+
+			BuildFromTemplate(park_template);
+		}
+
+		derived = true;
+	}
+	else if (file_name != L"")
 	{
 		BuildFromTemplate(file_name);
 	}
 	else
 	{
 		BuildFromTemplate(park_template);
-	}
 
-	std::sort(Rides.begin(), Rides.end(), sortByPopularity);
+		derived = true;
+	}
 
-	BuildDistanceCache();
+	if (derived)
+	{
+		BuildFastPassList();
+	}
+	else
+	{
+		BuildDerivedData();
+	}
 
-	BuildClosestCache();
+	EateryLocations.Build(Eateries, Rides);
 
 	BuildSelectionChoiceCache();
 
-	BuildFastPassList();
-
 	ShowConfig();
 }
 
 
+// sorts the rides, then builds the walk cache, closest rides, and fastpass lists (or reads them from the park cache)
+void ParkController::BuildDerivedData()
+{
+	// stable, so equal popularity keeps template order (as the built-in parks)
+	std::stable_sort(Rides.begin(), Rides.end(), sortByPopularity);
+
+	bool cached = false;
+
+	uint64_t fingerprint = 0;
+	std::wstring cache_file = L"";
+
+	if (GConfiguration->UseParkCache)
+	{
+		fingerprint = GetFingerprint();
+		cache_file = ParkCacheFile::GetFileName(GConfiguration->ParkCacheFolder, fingerprint);
+
+		cached = ParkCacheFile::Load(cache_file, fingerprint, WalkCache, Rides, FastPassTypes);
+	}
+
+	if (cached)
+	{
+		OutputStatus(L"Using park cache \"" + cache_file + L"\".");
+	}
+	else
+	{
+		BuildDistanceCache();
+
+		BuildClosestCache();
+
+		BuildFastPassList();
+
+		if (GConfiguration->UseParkCache)
+		{
+			ParkCacheFile::Save(cache_file, fingerprint, WalkCache, Rides, FastPassTypes);
+		}
+	}
+}
+
+
 void ParkController::AddToLog(const std::wstring log_entry)
 {
 	Log.push_back(log_entry);
@@ -259,7 +333,7 @@ int ParkController::GetDistanceBetweenInMinutes(int ride1, int ride2)
 		Location2 = Rides.size();
 	}
 
-	return WalkTimeCache[Location1][Location2];
+	return WalkCache.GetMinutes(Location1, Location2);
 }
 
 
@@ -278,15 +352,27 @@ int ParkController::GetDistanceBetweenInMetres(int ride1, int ride2)
 		Location2 = Rides.size();
 	}
 
-	return WalkDistanceCache[Location1][Location2];
+	return WalkCache.GetMetres(Location1, Location2);
+}
+
+
+// the cache holds whole minutes (metres / walk speed, plus the time to set off); with a finer tick the
+// part-minute the metres leave over is added back
+int ParkController::GetDistanceBetweenInTicks(int ride1, int ride2, int ticks_per_minute)
+{
+	int part_minute = (GetDistanceBetweenInMetres(ride1, ride2) % Constants::WalkSpeedMetresPerMinute) * ticks_per_minute / Constants::WalkSpeedMetresPerMinute;
+
+	return GetDistanceBetweenInMinutes(ride1, ride2) * ticks_per_minute + part_minute;
 }
 
 
 void ParkController::BuildDistanceCache()
 {
+	WalkCache.Resize(Rides.size() + 1);
+
 	for (int r1 = 0; r1 <= Rides.size(); r1++)
 	{
-		for (int r2 = 0; r2 <= Rides.size(); r2++)
+		for (int r2 = r1 + 1; r2 <= Rides.size(); r2++)
 		{
 			int X1;
 			int Y1;
@@ -319,16 +405,23 @@ void ParkController::BuildDistanceCache()
 			int dx = abs(X1 - X2);
 			int dy = abs(Y1 - Y2);
 
-			if (r1 == r2)
-			{
-				WalkTimeCache[r1][r2] = 0;
-				WalkDistanceCache[r1][r2] = 0;
-			}
-			else
-			{
-				WalkTimeCache[r1][r2]     = static_cast<int>(sqrt((double)dx * dx + dy * dy) / Constants::WalkSpeedMetresPerMinute) + 3;
-				WalkDistanceCache[r1][r2] = static_cast<int>(sqrt((double)dx * dx + dy * dy));
-			}
+			WalkCache.Set(r1, r2, static_cast<int>(sqrt((double)dx * dx + dy * dy)),
+				static_cast<int>(sqrt((double)dx * dx + dy * dy) / Constants::WalkSpeedMetresPerMinute) + 3);
+		}
+	}
+
+	// the straight-line values stay for any pair the walkways don't connect
+	if (!Walkways.IsEmpty())
+	{
+		OutputStatus(L"Routing walkways (" + std::to_wstring(Walkways.Junctions.size()) + L" junctions, " + std::to_wstring(Walkways.Paths.size()) + L" paths)...");
+
+		Walkways.Build(Rides, entrance.position);
+
+		int unreachable = Walkways.FillCache(WalkCache, Rides.size() + 1);
+
+		if (unreachable != 0)
+		{
+			std::wcerr << std::to_wstring(unreachable) << L" location pair(s) not connected by walkways, using straight line distance." << std::endl;
 		}
 	}
 }
@@ -364,9 +457,12 @@ void ParkController::BuildClosestCache()
 			}
 		}
 
-		std::sort(Distance.begin(), Distance.end(), sortByDistance);
+		// only the closest few are needed, so there's no need to sort the whole list
+		size_t closest = std::min((size_t)kClosestCacheSize, Distance.size());
 
-		for (int c = 0; c < kClosestCacheSize; c++)
+		std::partial_sort(Distance.begin(), Distance.begin() + closest, Distance.end(), sortByDistance);
+
+		for (int c = 0; c < closest; c++)
 		{
 			Rides[ride].ClosestCache[c] = Distance[c].ride;
 		}
@@ -409,6 +505,52 @@ void ParkController::BuildSelectionChoiceCache()
 }
 
 
+// everything the walk cache, closest cache, and fastpass lists depend on; rides must already be sorted
+uint64_t ParkController::GetFingerprint()
+{
+	ParkFingerprint fingerprint;
+
+	fingerprint.Add(kParkCacheFileVersion);
+	fingerprint.Add(Constants::WalkSpeedMetresPerMinute);
+	fingerprint.Add(kClosestCacheSize);
+
+	fingerprint.Add(entrance.position.x);
+	fingerprint.Add(entrance.position.y);
+
+	fingerprint.Add(static_cast<int>(Rides.size()));
+
+	for (int r = 0; r < Rides.size(); r++)
+	{
+		fingerprint.Add(Rides[r].RideOperation.name);
+		fingerprint.Add(Rides[r].RideOperation.position.x);
+		fingerprint.Add(Rides[r].RideOperation.position.y);
+		fingerprint.Add(Rides[r].RideOperation.templateID);
+		fingerprint.Add(Rides[r].FastPass.mode);
+	}
+
+	fingerprint.Add(static_cast<int>(Walkways.Junctions.size()));
+
+	for (int j = 0; j < Walkways.Junctions.size(); j++)
+	{
+		fingerprint.Add(Walkways.Junctions[j].x);
+		fingerprint.Add(Walkways.Junctions[j].y);
+	}
+
+	fingerprint.Add(static_cast<int>(Walkways.Paths.size()));
+
+	for (int p = 0; p < Walkways.Paths.size(); p++)
+	{
+		fingerprint.Add(static_cast<int>(Walkways.Paths[p].from.type));
+		fingerprint.Add(Walkways.Paths[p].from.id);
+		fingerprint.Add(static_cast<int>(Walkways.Paths[p].to.type));
+		fingerprint.Add(Walkways.Paths[p].to.id);
+		fingerprint.Add(Walkways.Paths[p].length);
+	}
+
+	return fingerprint.Get();
+}
+
+
 // add this ride to the correct fastpass list type 1, type 2, or type 3
 // already ordered by popularity
 void ParkController::BuildFastPassList()
@@ -476,288 +618,51 @@ void ParkController::ShowConfig()
 }
 
 
+// built-in parks come with the rides in popularity order, and the walk cache and closest rides worked
+// out, at compile time (see BuiltInParks.h)
 void ParkController::BuildFromTemplate(ParkTemplate park_template)
 {
-	switch (park_template)\
-	{
-	case ParkTemplate::Test:
-
-		SetEntrance(L"Super Cat Park", 0, 0, 0, 10000,
-			8, 8, 5, 5, 0, 0, 12000);
+	BuiltInParks::BuiltInPark park = BuiltInParks::Get(park_template);
 
-		AddNewRideShow(L"Cats throughout the ages", 30,             RideExitType::Short, 60, 2000, 2000,  1, -200,  50, 0, 0, true, true, false);
-		AddNewRideShow(L"Idea of a certain cat", 10,                RideExitType::Short, 15, 1000,  250, 12,    3, 300, 0, 0, true, true, false);
+	const BuiltInParks::EntranceData& e = *park.Entrance;
 
-		AddNewRideContinuous(L"Katzen-Kogl", 4,                     RideExitType::Short, 1800,  4, -200, 150, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Le chat blanc", 4,                   RideExitType::Short, 1800,  2,  200, 150, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Raminou", 4,                         RideExitType::Short, 1800, 10, -200, 250, 0, 0, true, true, false);
-		AddNewRideContinuous(L"White cat playing with a string", 4, RideExitType::Short, 1800,  7,  200, 250, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Rutherford Freeman Maxwell", 4,      RideExitType::Short, 1800,  8,  200,  50, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Siamese adventure", 4,               RideExitType::Short, 1800,  9,    0, 100, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Fluffy cat surprise", 4,             RideExitType::Short, 1800,  5,    0, 200, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Meow meow meow!", 4,                 RideExitType::Short, 1800,  6,    0,  50, 0, 0, true, true, false);
-
-		break;
-
-	case ParkTemplate::WDWAnimalKingdom:
-
-		SetEntrance(L"Animal Kingdom", 0, 0, 1, 38000,
-			118, 118, 112, 112, 0, 0, 60000);
-
-		AddNewRideShow(L"Feathered Friends in Flight!",           35, RideExitType::Short,       60, 1000, 1000, 12,   10, 389, 2, 70, true, true, false); // temp replaces "UP! A Great Bird Adventure"
-		AddNewRideShow(L"Festival of the Lion King",              30, RideExitType::Short,       60, 1500, 1500,  6, -265, 337, 2, 70, true, true, false);
-		AddNewRideShow(L"Finding Nemo: The Big Blue and Beyond!", 30, RideExitType::Short,       60, 1500, 1500, 11,  290, 205, 2, 70, true, true, false);
-
-		AddNewRideContinuous(L"Animation Academy",                23, RideExitType::Short,      110,  8, -125, 476, 0,  0, true, true, false);
-		AddNewRideContinuous(L"Gorilla Falls Exploration Trail",  23, RideExitType::Short,     2000,  5, -198, 476, 0,  0, true, true, false);
-		AddNewRideContinuous(L"DINOSAUR",                          4, RideExitType::Shop,      1800,  3,  184,  37, 2, 70, true, true, false);
-		AddNewRideContinuous(L"Expedition Everest",                3, RideExitType::Shop,      1900,  2,  323, 352, 2, 70, true, true, false); // 1800-2060
-		AddNewRideContinuous(L"Flights of Passage",                5, RideExitType::LargeShop, 1300,  1, -227,  30, 1, 70, true, true, false); // 1280-1440; exit then shop
-		AddNewRideContinuous(L"It's tough to be a bug",            8, RideExitType::Short,     1800,  9,  -59, 295, 2, 70, true, true, false);
-		AddNewRideContinuous(L"Kali River Rapids",                 4, RideExitType::Short,     1900,  7,  180, 418, 2, 70, true, true, false); // 1800-2000
-		AddNewRideContinuous(L"Kilimanjaro Safaris",              19, RideExitType::Short,     3000,  5, -211, 444, 2, 70, true, true, false);
-		AddNewRideContinuous(L"Na'vi River Journey",               5, RideExitType::Short,     1200,  4, -160,   0, 1, 70, true, true, false); // 1080-1440
-		AddNewRideContinuous(L"TriceraTop Spin",                   2, RideExitType::Short,      850, 10,  186, 107, 0,  0, true, true, false); // 800-900
-		AddNewRideContinuous(L"Wildlife Express Train",            7, RideExitType::Short,     1500,  8, -123, 476, 0,  0, true, true, false); // 1000-1250 (per station, two trains operating)
-
-		AddFoodDrink(L"Flame Tree Barbecue", 3, true, true,  77,  220, 15, 10, 8);
-		AddFoodDrink(L"Picnic in the Park",  3, true, true, -79,  184, 15, 10, 8);
-		AddFoodDrink(L"Pizzafari",           3, true, true, -132, 205, 10, 10, 8);
-		AddFoodDrink(L"Rainforest Cafe",     3, true, true,  -58, -90, 15, 10, 8);
-		AddFoodDrink(L"Restaurantosaurus",   3, true, true,  122,  68, 15, 10, 8);
-		AddFoodDrink(L"Tusker House",        3, true, true, -198, 367, 15, 10, 8);
-		AddFoodDrink(L"Tak and Yeti",        3, true, true,   64, 371, 15, 10, 8);
-		AddFoodDrink(L"Royal Anandapur Tea", 3, true, false,  80, 337, 15, 10, 8);
-
-		break;
+	SetEntrance(e.Name, e.x, e.y, e.FastPassType, e.AverageVisitors,
+		e.Adult, e.AdultAdvance, e.Children, e.ChildrenAdvance, e.Babies, e.BabiesAdvance, e.MaximumCapacity);
 
-	case ParkTemplate::WDWEpcot:
-
-		SetEntrance(L"EPCOT", 0, 0, 1, 34000,
-			118, 118, 112, 112, 0, 0, 110000);
-
-		AddNewRideShow(L"The American Adventure", 29, RideExitType::Short, 60, 1024, 1024, 9, 0, 925, 0, 0, true, true, false);
-
-		AddNewRideContinuous(L"Frozen Ever After",                               5, RideExitType::Shop,  1100,  5, -274, 587, 2, 70, true, true, false); // 1100-1200
-		AddNewRideContinuous(L"Gran Fiesta Tour Starring the Three Caballeros",  8, RideExitType::Short, 1800,  6, -245, 435, 0,  0, true, true, false); // 1800-2000
-		AddNewRideContinuous(L"Guardians of the Galaxy: Cosmic Rewind",          4, RideExitType::Short, 2000,  1, -151, 192, 1, 70, true, true, false);
-		AddNewRideContinuous(L"Living With The Land",                           14, RideExitType::Short, 2445,  7,  324, 194, 2, 70, true, true, false);
-		AddNewRideContinuous(L"Mission: SPACE",                                  6, RideExitType::Shop,  1600,  8, -213, 550, 2, 70, true, true, false); // between Green and Orange teams
-		AddNewRideContinuous(L"O Canada!",                                      18, RideExitType::Short,  610, 11,  197, 477, 0,  0, true, true, false);
-		AddNewRideContinuous(L"Remys Ratatouille Adventure",                    5, RideExitType::Short, 2000,  4,  320, 820, 0,  0, true, true, false); // 2000-2200
-		AddNewRideContinuous(L"Soarin Around the World",                        5, RideExitType::Short, 1827,  2,  273, 332, 1, 70, true, true, false); // 1827 (official), 2000-2100 actual
-		AddNewRideContinuous(L"Spaceship Earth",                                15, RideExitType::Short, 2400,  3,    0,  85, 2, 70, true, true, false);
-		AddNewRideContinuous(L"Test Track",                                      4, RideExitType::Shop,  1600,  1, -177, 337, 1, 70, true, true, false);
-		AddNewRideContinuous(L"The Seas with Nemo & Friends",                    4, RideExitType::Shop,  2000, 10,  145, 124, 0,  0, true, true, false); // 2000-2200
-
-		AddFoodDrink(L"Akershus Royal Banquet Hall", 3, true, true, 254, 638, 15, 10, 8);
-		AddFoodDrink(L"L'Artisan des Glaces", 3, true, true, -331, 829, 10, 10, 8);
-		AddFoodDrink(L"Biergarten", 3, true, true, 254, 901, 15, 10, 8);
-		AddFoodDrink(L"Boulangerie Patisserie", 3, true, true, -349, 842, 10, 10, 8);
-		AddFoodDrink(L"La Cantina", 3, true, true, 171, 561, 15, 10, 8);
-		AddFoodDrink(L"Le Cellier", 3, true, true, -211, 518, 15, 10, 8);
-		AddFoodDrink(L"Chefs de France", 3, true, true, -316, 813, 15, 10, 8);
-		AddFoodDrink(L"Coral Reef", 3, true, true, -109, 131, 15, 10, 8);
-		AddFoodDrink(L"Electric Umbrella", 3, true, true, 38, 235, 15, 10, 8);
-		AddFoodDrink(L"Garden Grill", 3, true, true, -263, 256, 15, 10, 8);
-		AddFoodDrink(L"Kringla Bakeri og Cafe", 3, true, true, 229, 609, 15, 10, 8);
-		AddFoodDrink(L"Liberty Inn", 3, true, true, 40, 970, 15, 10, 8);
-		AddFoodDrink(L"Lotus Blossom Cafe", 3, true, true, 282, 668, 15, 10, 8);
-		AddFoodDrink(L"Nine Dragons", 3, true, true, 254, 675, 15, 10, 8);
-		AddFoodDrink(L"Restaurant Marrakesh", 3, true, true, -263, 938, 15, 10, 8);
-		AddFoodDrink(L"Rose and Crown Pub", 3, true, true, -209, 638, 15, 10, 8);
-		AddFoodDrink(L"Sam Angel Inn", 3, true, true, 127, 496, 15, 10, 8);
-		AddFoodDrink(L"Sommerfest", 3, true, true, 231, 905, 15, 10, 8);
-		AddFoodDrink(L"Spice Road Table", 3, true, true, -211, 851, 15, 10, 8);
-		AddFoodDrink(L"Sunshine Season Food Fair", 3, true, true, -263, 256, 15, 10, 8);
-		AddFoodDrink(L"Tangierine Cafe", 3, true, true, -263, 878, 15, 10, 8);
-		AddFoodDrink(L"Teppan Edo", 3, true, true, -131, 931, 15, 10, 8);
-		AddFoodDrink(L"Tutto Italia", 3, true, true, 141, 960, 15, 10, 8);
-		AddFoodDrink(L"Via Napoli", 3, true, true, 128, 996, 15, 10, 8);
-		AddFoodDrink(L"Yakitori House", 3, true, true, -94, 954, 15, 10, 8);
-		AddFoodDrink(L"Yorkshire County Fish Shop", 3, true, true, -222, 656, 10, 10, 8);
-
-		AddFoodDrink(L"La Cava del Tequila", 3, false, true, 219, 514, 15, 10, 8);
-		AddFoodDrink(L"Club Cool", 3, false, true, -34, 319, 15, 10, 8);
-		AddFoodDrink(L"Tutto Gusto", 3, false, true, 137, 974, 15, 10, 8);
-		
-		break;
+	Rides.reserve(park.RideCount);
 
-	case ParkTemplate::WDWHollywoodStudios:
-
-		SetEntrance(L"Hollywood Studios", 0, 0, 1, 31000,
-			118, 118, 112, 112, 0, 0, 60000);
-
-		AddNewRideShow(L"Indiana Jones Epic Stunt Spectacular!",            30, RideExitType::Short,   60, 2000, 2000, 10, -190, 0, 2, 70, true, true, false);
-		AddNewRideShow(L"Muppet*Vision 3-D",                                15, RideExitType::Short,   15, 2256, 564, 8, -290, 142, 2, 70, true, true, false); // 564 per show
-
-		AddNewRideContinuous(L"Alien Swirling Saucers",                      2, RideExitType::Short,  600, 12, -200, 275, 2, 70, true, true, false);
-		AddNewRideContinuous(L"Beauty and the Beast Live on Stage",         30, RideExitType::Shop,   100, 11,  118,  23, 2, 70, true, true, false);
-		AddNewRideContinuous(L"Lightning McQueen's Racing Academy",         10, RideExitType::Short, 1500, 14,  203,  89, 0,  0, true, true, false); // guess
-		AddNewRideContinuous(L"Mickey & Minnies Runaway Railway",           5, RideExitType::Short, 1800,  6, -122, 105, 1, 70, true, true, false); // 1800-2000
-		AddNewRideContinuous(L"Millennium Falcon: Smugglers Run",            5, RideExitType::Short, 1700,  7, -405, 412, 1, 70, true, true, false);
-		AddNewRideContinuous(L"Rock n Roller Coaster Starring Aerosmith",  2, RideExitType::Shop,  1400,  5,  221,  76, 2, 70, true, true, false); // 1400-1600
-		AddNewRideContinuous(L"Slinky Dog Dash",                             2, RideExitType::Short, 1440,  4,   70, 384, 1, 70, true, true, false);
-		AddNewRideContinuous(L"Star Tours The Adventures Continue",          5, RideExitType::Shop,  1890,  9, -270,  72, 2, 70, true, true, false); // 1800-1950
-		AddNewRideContinuous(L"Star Wars: Rise of the Resistance",          18, RideExitType::Short, 1300,  1, -323, 243, 2, 70, true, true, false); // 1300-1700
-		AddNewRideContinuous(L"The Twilight Zone Tower of Terror",          50, RideExitType::Shop,  1700,  2,  176,   5, 2, 70, true, true, false);
-		AddNewRideContinuous(L"Toy Story Midway Mania!",                     8, RideExitType::Short, 1600,  3, -155, 261, 2, 70, true, true, false); // 1600-1700
-		AddNewRideContinuous(L"Voyage of the Little Mermaid",               15, RideExitType::Short, 1900, 12,  -25, 192, 2, 70, true, true, false);
-	            
-		AddFoodDrink(L"50's Prime-Time Cafe", 3, true, true, -91, 18, 15, 10, 8);
-		AddFoodDrink(L"ABC Commissary", 3, true, true, -166, 161, 15, 10, 8);
-		AddFoodDrink(L"Backlot Express", 3, true, true, -250, 35, 10, 10, 8);
-		AddFoodDrink(L"The Hollywood Brown Derby", 3, true, true, -27, 144, 15, 10, 8);
-		AddFoodDrink(L"Hollywood and Vine", 3, true, true, -43, 40, 15, 10, 8);
-		AddFoodDrink(L"Mama Melrose's", 3, true, true, -387, 147, 15, 10, 8);
-		AddFoodDrink(L"Rizzo's Pizza", 3, true, true, -320, 113, 15, 10, 8);
-		AddFoodDrink(L"Sci-Fi Dine-in Theater", 3, true, true, -229, 143, 15, 10, 8);
-		AddFoodDrink(L"Starring Rolls Cafe", 3, true, true, 10, 108, 15, 10, 8);
-		AddFoodDrink(L"Sunset Blvd. Courtyard", 3, true, true, 127, 105, 15, 10, 8);
-		AddFoodDrink(L"Hollywood Brown Derby Lounge", 3, false, true, -26, 127, 15, 10, 8);
-		AddFoodDrink(L"Trolly Car Cafe", 3, false, true, -18, 77, 15, 10, 8);
-		AddFoodDrink(L"Tune-in Lounge", 3, false, true, -70, 29, 15, 10, 8);
+	for (int r = 0; r < park.RideCount; r++)
+	{
+		const BuiltInParks::RideData& ride = park.Rides[park.Order[r]];
 
-		break;
+		if (ride.Type == RideType::Show)
+		{
+			AddNewRideShow(ride.Name, ride.RideLength, ride.ExitType, ride.ShowStartTime, ride.HourlyThroughput, ride.ShowCapacity, ride.Popularity, ride.x, ride.y, ride.FastPass, ride.FastPassReservePercent, ride.AdultValid, ride.ChildValid, ride.BabyValid);
+		}
+		else
+		{
+			AddNewRideContinuous(ride.Name, ride.RideLength, ride.ExitType, ride.HourlyThroughput, ride.Popularity, ride.x, ride.y, ride.FastPass, ride.FastPassReservePercent, ride.AdultValid, ride.ChildValid, ride.BabyValid);
+		}
 
-	case ParkTemplate::WDWMagicKingdom:
-
-		SetEntrance(L"Magic Kingdom", 0, 0, 3, 57000,
-			118, 118, 112, 112, 0, 0, 100000);
-
-		AddNewRideContinuous(L"its a small world",                           11, RideExitType::Short, 2000,  9,  -73, 428, 3, 70, true, true, false); // the best ride in the whole universe
-		AddNewRideContinuous(L"Astro Orbiter",                                 2, RideExitType::Short,  300, 15,  270, 201, 0,  0, true, true, false);
-		AddNewRideContinuous(L"Big Thunder Mountain Railroad",                 4, RideExitType::Short, 1400,  2, -338, 363, 3, 70, true, true, false);
-		AddNewRideContinuous(L"Buzz Lightyear Space Ranger Spin",              4, RideExitType::Shop,  1200,  9,  167, 165, 3, 70, true, true, false);
-		AddNewRideContinuous(L"Dumbo the Flying Elephant",                     2, RideExitType::Short, 1200, 10,  219, 409, 3, 70, true, true, false);
-		AddNewRideContinuous(L"Jungle Cruise",                                10, RideExitType::Short, 1200,  6, -225, 156, 3, 70, true, true, false); // 1200 (official) 1350-1450 actual
-		AddNewRideContinuous(L"Liberty Square Riverboat",                     13, RideExitType::Short,  900, 13, -164, 328, 0,  0, true, true, false);
-		AddNewRideContinuous(L"Mad Tea Party",                                 2, RideExitType::Short,  900, 11,  137, 368, 3, 70, true, true, false); // 900-1000
-		AddNewRideContinuous(L"Peter Pans Flight",                            3, RideExitType::Short, 1075,  8,  -77, 407, 3, 70, true, true, false); // 1075-1200
-		AddNewRideContinuous(L"Pirates of the Caribbean",                      9, RideExitType::Shop,  3400,  7, -300, 170, 3, 70, true, true, false);
-		AddNewRideContinuous(L"Prince Charming Regal Carrousel",               2, RideExitType::Short,  700, 12,    0, 377, 0,  0, true, true, false); // 700-1000
-		AddNewRideContinuous(L"Space Mountain",                                3, RideExitType::Shop,  2000,  5,  316, 275, 3, 70, true, true, false);
-		AddNewRideContinuous(L"Splash Mountain",                              11, RideExitType::Shop,  1800,  3, -400, 290, 3, 70, true, true, false);
-		AddNewRideContinuous(L"The Haunted Mansion",                           8, RideExitType::Short, 2400,  1, -186, 408, 3, 70, true, true, false);
-		AddNewRideContinuous(L"The Many Adventures of Winnie the Pooh",        4, RideExitType::Shop,   600, 13,   87, 390, 3, 70, true, true, false); // 600-800
-		AddNewRideContinuous(L"Tomorrowland Transit Authority Peoplemover",   10, RideExitType::Short, 3600,  4,  188, 194, 0,  0, true, true, false);
-		AddNewRideContinuous(L"Under the Sea: Journey of the Little Mermaid",  7, RideExitType::Short, 1800, 17,  142, 472, 3, 70, true, true, false); // 1800-1994
-		AddNewRideContinuous(L"Walt Disneys Carousel of Progress",           21, RideExitType::Short, 3600, 16,  190, 114, 0,  0, true, true, false); // 240 per show
-	                           
-		AddFoodDrink(L"Be Our Guest", 3, true, true, 34, 517, 15, 10, 8);
-		AddFoodDrink(L"Casey's Corner", 3, true, true, 8, 144, 15, 10, 8);
-		AddFoodDrink(L"Cinderall's Royal Table", 3, true, true, 12, 327, 15, 10, 8);
-		AddFoodDrink(L"Columbia Harbour House", 3, true, true, -145, 387, 15, 10, 8);
-		AddFoodDrink(L"Crystal Palace", 3, true, true, 127, 306, 15, 10, 8);
-		AddFoodDrink(L"Gaston's Tavern", 3, true, true, -73, 150, 15, 10, 8);
-		AddFoodDrink(L"Goldern Oak Outpost", 3, true, true, 62, 525, 15, 10, 8);
-		AddFoodDrink(L"Liberty Tree Tavern", 3, true, true, -356, 227, 15, 10, 8);
-		AddFoodDrink(L"Main Street Bakery", 3, true, true, -133, 265, 15, 10, 8);
-		AddFoodDrink(L"Main Street Confectionary", 3, true, true, 8, 51, 10, 10, 8);
-		AddFoodDrink(L"Pecos Bill Tall Tale Cafe", 3, true, true, -323, 231, 15, 10, 8);
-		AddFoodDrink(L"Pinocchio Village Haus", 3, true, true, -20, 433, 15, 10, 8);
-		AddFoodDrink(L"Plaza Ice Cream", 3, true, true, 25, 128, 10, 10, 8);
-		AddFoodDrink(L"Tomorrowland Terrace", 3, true, true, 80, 170, 15, 10, 8);
-		AddFoodDrink(L"Tony's Town Square Restaurant", 3, true, true, 45, 19, 15, 10, 8);
-		AddFoodDrink(L"Tortuga Tavern", 3, true, true, -292, 191, 15, 10, 8);
+		Rides.back().RideOperation.templateID = park.Order[r];
 
-		break;
+		for (int c = 0; c < kClosestCacheSize; c++)
+		{
+			Rides.back().ClosestCache[c] = park.Closest[r][c];
+		}
+	}
 
-	case ParkTemplate::Arcade:
-
-		SetEntrance(L"Arcade", 0, 0, 0, 5000,
-			        5, 5, 5, 5, 0, 0, 6000);
-
-		AddNewRideContinuous(L"Outrun",            2, RideExitType::Short, 120, 1, -20, 10, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Pac-Man",           2, RideExitType::Short, 120, 1, -10, 10, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Ghosts n Goblins",  2, RideExitType::Short, 120, 1,   0, 10, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Bubble Bobble",     2, RideExitType::Short, 120, 1, -10, 10, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Golden Axe",        2, RideExitType::Short, 120, 1, -20, 10, 0, 0, true, true, false);
-
-		AddNewRideContinuous(L"Afterburner",       2, RideExitType::Short, 120, 1, -20, 20, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Afterburner II",    2, RideExitType::Short, 120, 1, -10, 20, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Galaxian",          2, RideExitType::Short, 120, 1,   0, 20, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Samurai Shodown 2", 2, RideExitType::Short, 120, 1, -10, 20, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Virtua Cop",        2, RideExitType::Short, 120, 1, -20, 20, 0, 0, true, true, false);
-
-		AddNewRideContinuous(L"Final Fight",       3, RideExitType::Short, 120, 1, -20, 30, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Op Wolf",           3, RideExitType::Short, 120, 1, -10, 30, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Mortal Kombat",     3, RideExitType::Short, 120, 1,   0, 30, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Growl",             3, RideExitType::Short, 120, 1, -10, 30, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Street Fighter",    3, RideExitType::Short, 120, 1, -20, 30, 0, 0, true, true, false);
-
-		AddNewRideContinuous(L"Gauntlet",          2, RideExitType::Short, 120, 1, -20, 40, 0, 0, true, true, false);
-		AddNewRideContinuous(L"1942",              2, RideExitType::Short, 120, 1, -10, 40, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Rampage",           2, RideExitType::Short, 120, 1,   0, 40, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Bomb Jack",         2, RideExitType::Short, 120, 1, -10, 40, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Tekken",            2, RideExitType::Short, 120, 1, -20, 40, 0, 0, true, true, false);
-
-		AddNewRideContinuous(L"Space Invaders",    2, RideExitType::Short, 120, 1, -20, 50, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Powerdrift",        2, RideExitType::Short, 120, 1, -10, 50, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Metal Slug",        2, RideExitType::Short, 120, 1,   0, 50, 0, 0, true, true, false);
-		AddNewRideContinuous(L"R-Type",            2, RideExitType::Short, 120, 1, -10, 50, 0, 0, true, true, false);
-		AddNewRideContinuous(L"Galaga",            2, RideExitType::Short, 120, 1, -20, 50, 0, 0, true, true, false);
-		
-		break;
+	Eateries.reserve(park.EateryCount);
 
-	case ParkTemplate::AltonTowers:
-
-		SetEntrance(L"Alton Towers", 100, 740, 0, 25000,
-					80, 44, 74, 44, 0, 0, 28000);
-
-		AddNewRideShow(L"The Alton Towers Dungeon", 45, RideExitType::Short, 60, 1000, 1000, 10, 0, 0, 0, 0, true, true, false);
-
-		AddNewRideContinuous(L"The Smiler",                            3, RideExitType::Shop,  1200,  1, -118, 352, 1, 70, true, true,  false);
-		AddNewRideContinuous(L"Nemesis",                               2, RideExitType::Short, 1400,  2,  733, 296, 1, 70, true, true,  false);
-		AddNewRideContinuous(L"Oblivion",                              2, RideExitType::Short, 1900,  3, -170, 268, 1, 70, true, false, false);
-		AddNewRideContinuous(L"Rita",                                  1, RideExitType::Short, 1150,  4,  265,  86, 1, 70, true, false, false);
-		AddNewRideContinuous(L"Th13teen",                              2, RideExitType::Short, 1100,  5,  223,  82, 1, 70, true, true,  false);
-		AddNewRideContinuous(L"Enterprise",                            2, RideExitType::Short, 1400,  6, -196, 361, 1, 70, true, false, false);
-		AddNewRideContinuous(L"Galactica",                             2, RideExitType::Short, 1500,  7,  796, 158, 1, 70, true, false, false);
-		AddNewRideContinuous(L"Wicker Man",                            2, RideExitType::Short,  952,  8,  308, 559, 1, 70, true, true,  false);
-		AddNewRideContinuous(L"Hex: The Legend of the Towers",         6, RideExitType::Short,  500,  9,   77, 156, 1, 70, true, true,  false); // 78 per vault
-		AddNewRideContinuous(L"Spinball Whizzer",                      2, RideExitType::Short,  950, 10,  -30, 523, 1, 70, true, true,  false);
-
-		AddNewRideContinuous(L"Runaway Train",                         2, RideExitType::Short, 1100, 11,  549, 614, 1, 70, true, true,  false);
-		AddNewRideContinuous(L"Duel: The Haunted House Strikes Back!", 6, RideExitType::Short, 1920, 12,  686, 556, 1, 70, true, true,  false);
-		AddNewRideContinuous(L"Congo River Rapids",                    6, RideExitType::Short, 1800, 13,  442, 565, 1, 70, true, true,  false);
-		AddNewRideContinuous(L"Battle Galleons",                       3, RideExitType::Short,  800, 14,  237, 467, 0,  0, true, true,  false);
-		AddNewRideContinuous(L"The Blade",                             2, RideExitType::Short, 1300, 15,  661, 296, 1, 70, true, true,  false);
-		AddNewRideContinuous(L"Raj's Bouncy Bottom Burp",              2, RideExitType::Short,  200, 16,    0, 127, 0,  0, true, true,  false);
-		AddNewRideContinuous(L"Heave Ho!",                             2, RideExitType::Short,  600, 17,  216, 601, 0,  0, true, true,  false);
-		AddNewRideContinuous(L"The Royal Carousel",                    2, RideExitType::Short,  450, 18,   -7,  51, 0,  0, true, true,  false);
-		AddNewRideContinuous(L"Marauder's Mayhem",                     2, RideExitType::Short, 1200, 19,  244, 594, 0,  0, true, true,  false);
-		AddNewRideContinuous(L"Spinjam",                               2, RideExitType::Short,  950, 20, -195, 317, 0,  0, true, true,  false);
-
-		AddNewRideContinuous(L"Gangsta Granny: The Ride",              2, RideExitType::Short, 1100, 21,   23,  87, 1, 70, true, true,  false);
-		AddNewRideContinuous(L"Flavio's Fabulous Fandango",            2, RideExitType::Short,  950, 22,   57,  75, 0,  0, true, true,  false); //guess
-		AddNewRideContinuous(L"Cuckoo Cars Driving School",            4, RideExitType::Short,  450, 23,   41, 125, 0,  0, true, true,  false);
-		AddNewRideContinuous(L"Octonauts Rollercoaster Adventure",     2, RideExitType::Short,  580, 24,   40, 567, 0,  0, true, true,  false);
-		AddNewRideContinuous(L"Funk'n'Fly",                            2, RideExitType::Short,  480, 25,  700, 245, 0,  0, true, true,  false);
-		AddNewRideContinuous(L"Skyride",                               5, RideExitType::Short, 2800, 26,  158, 618, 0,  0, true, true,  false);
-
-		AddFoodDrink(L"Tower's Street Hot Dogs", 3, true, true, 16, 70, 10, 10, 8);
-		AddFoodDrink(L"Corner Coffee", 3, false, true, -36, 78, 10, 10, 8);
-		AddFoodDrink(L"Eastern Express", 3, true, true, 175, 113, 15, 10, 8);
-		AddFoodDrink(L"Donut Factory", 3, true, true, -231, 268, 10, 10, 8);
-		AddFoodDrink(L"Woodcutter's Bar and Grill", 3, true, true, 15, 434, 15, 10, 8);
-		AddFoodDrink(L"Pizza and Pasta", 3, true, true, 434, 107, 15, 10, 8);
-		AddFoodDrink(L"Just Chicken", 3, true, true, -199, 424, 15, 10, 8);
-		AddFoodDrink(L"Nemice's Donuts", 3, true, true, 487, 415, 10, 10, 8);
-		AddFoodDrink(L"Rollercoaster", 3, true, true, 634, 512, 15, 10, 8);
-		AddFoodDrink(L"Little Explorer's Lunchbox", 3, true, true, -74, 17, 15, 10, 8);
-		AddFoodDrink(L"Coffee Lounge", 3, false , true, -39, 719, 15, 10, 8);
-		AddFoodDrink(L"Burger Kitchen", 3, true, true, 609, 467, 10, 10, 8);
-		AddFoodDrink(L"Welcom-Inn", 2, true, true, 162, 185, 15, 10, 8);
-		AddFoodDrink(L"Courtyard Nachos/Waffles/Hotdogs", 3, true, true, 162, 185, 10, 10, 8);
-		AddFoodDrink(L"Wafflemeister", 2, true, true, 380, 375, 15, 10, 8);
-		AddFoodDrink(L"Nitrogenie", 2, true, true, 510, 209, 10, 10, 8);
-
-		AddFoodDrink(L"Vending Machines", 8, false, true, -229, 268, 5, 1, 1);
+	for (int f = 0; f < park.EateryCount; f++)
+	{
+		const BuiltInParks::EateryData& eatery = park.Eateries[f];
 
-		break;
+		AddFoodDrink(eatery.Name, eatery.Throughput, eatery.Food, eatery.Drink, eatery.x, eatery.y, eatery.WaitTime, eatery.AverageAdult, eatery.AverageChild);
 	}
 
+	WalkCache.Share(park.Walk, park.RideCount + 1);
+
 	UpdateThroughput();
 }
 
@@ -796,75 +701,17 @@ void ParkController::OutputStatus(const std::wstring status)
 // =================================================================================================================
 
 
-// get the closest eatery (from the top 3) that has a wait time less than the group requirement
-QWaitTypes::GetEatery ParkController::GetClosestEatery(QWaitTypes::Coords position, int max_wait_time)
+// get the closest eatery (from the closest kClosestEateryCount) that has a wait time less than the group requirement.
+// ride is the ride the group last went to, if they're still there its cached list is used
+QWaitTypes::GetEatery ParkController::GetClosestEatery(QWaitTypes::Coords position, int max_wait_time, int ride)
 {
-	int eatery[5] = { -1, -1, -1, -1, -1 };
-	double distance[5] = { 99999, 99999, 99999, 99999, 99999 };
-
-	for (int e = 0; e < Eateries.size(); e++)
-	{
-		int dx = abs(position.x - Eateries[e].X);
-		int dy = abs(position.y - Eateries[e].Y);
-
-		double d = static_cast<int>(sqrt((double)dx * dx + dy * dy));
+	NearestEateries nearest = EateryLocations.Nearest(position, ride);
 
-		if (d < distance[0])
-		{
-			distance[4] = distance[3];
-			distance[3] = distance[2];
-			distance[2] = distance[1];
-			distance[1] = distance[0];
-			distance[0] = d;
-
-			eatery[4] = eatery[3];
-			eatery[3] = eatery[2];
-			eatery[2] = eatery[1];
-			eatery[1] = eatery[0];
-			eatery[0] = e;
-		}
-		else if (d < distance[1])
-		{
-			distance[4] = distance[3];
-			distance[3] = distance[2];
-			distance[2] = distance[1];
-			distance[1] = d;
-
-			eatery[4] = eatery[3];
-			eatery[3] = eatery[2];
-			eatery[2] = eatery[1];
-			eatery[1] = e;
-		}
-		else if (d < distance[2])
-		{
-			distance[4] = distance[3];
-			distance[3] = distance[2];
-			distance[2] = d;
-
-			eatery[4] = eatery[3];
-			eatery[3] = eatery[2];
-			eatery[2] = e;
-		}
-		else if (d < distance[3])
-		{
-			distance[4] = distance[3];
-			distance[3] = d;
-
-			eatery[4] = eatery[3];
-			eatery[3] = e;
-		}
-		else if (d < distance[4])
-		{
-			distance[4] = d;
-			eatery[4] = e;
-		}
-	}
-
-	for (int t = 0; t < 5; t++)
+	for (int t = 0; t < nearest.Count; t++)
 	{
-		if (Eateries[eatery[t]].QueueWaitTime() <= max_wait_time)
+		if (Eateries[nearest.Eatery[t]].QueueWaitTime() <= max_wait_time)
 		{
-			return { eatery[t], distance[t], -1, {Eateries[eatery[t]].X, Eateries[eatery[t]].Y} };
+			return { nearest.Eatery[t], (double)nearest.Distance[t], -1, {Eateries[nearest.Eatery[t]].X, Eateries[nearest.Eatery[t]].Y} };
 		}
 	}
 
@@ -993,6 +840,8 @@ bool ParkController::BuildFromTemplate(const std::wstring file_name)
 					else
 					{
 						AddNewRideShow(name, l, e, s, h, c, p, x, y, i, f, u, v, w);
+
+						Rides.back().RideOperation.templateID = r;
 					}
 				}
 				else if (type == L"c")
@@ -1017,6 +866,8 @@ bool ParkController::BuildFromTemplate(const std::wstring file_name)
 					else
 					{
 						AddNewRideContinuous(name, l, e, h, p, x, y, i, f, u, v, w);
+
+						Rides.back().RideOperation.templateID = r;
 					}
 				}
 				else
@@ -1060,6 +911,39 @@ bool ParkController::BuildFromTemplate(const std::wstring file_name)
 				}
 			}
 		}
+
+		int junction_count = config->ReadInteger(L"walkways", L"junctioncount", 0);
+		int path_count = config->ReadInteger(L"walkways", L"pathcount", 0);
+
+		for (int j = 1; j <= junction_count; j++)
+		{
+			std::wstring junction = config->ReadString(L"walkways", L"junction" + std::to_wstring(j), L"");
+
+			QWaitTypes::Coords position = { 0, 0 };
+
+			if (!WalkwayGraph::ParseJunction(junction, position))
+			{
+				std::wcerr << L"junction" << j << L" : should be x,y \"" << junction << L"\"" << std::endl;
+			}
+
+			Walkways.Junctions.push_back(position);
+		}
+
+		for (int p = 1; p <= path_count; p++)
+		{
+			std::wstring path = config->ReadString(L"walkways", L"path" + std::to_wstring(p), L"");
+
+			WalkwayPath wp;
+
+			if (WalkwayGraph::ParsePath(path, wp))
+			{
+				Walkways.Paths.push_back(wp);
+			}
+			else
+			{
+				std::wcerr << L"path" << p << L" : should be from,to or from,to,length \"" << path << L"\"" << std::endl;
+			}
+		}
 	}
 	else
 	{
@@ -1149,6 +1033,14 @@ void ParkController::SaveAsTemplate(const std::wstring file_name)
 }
 
 
+bool ParkController::SaveAsImage(const std::wstring file_name)
+{
+	OutputStatus(L"Saving park image \"" + file_name + L"\"...");
+
+	return ParkImage::Save(file_name, *this);
+}
+
+
 bool ParkController::SaveDistanceCache(const std::wstring file_name)
 {
 	std::wofstream file(file_name);
@@ -1174,7 +1066,7 @@ bool ParkController::SaveDistanceCache(const std::wstring file_name)
 
 			for (int x = 0; x < Rides.size() + 1; x++)
 			{
-				row += L"," + std::to_wstring(WalkDistanceCache[x][y]);
+				row += L"," + std::to_wstring(WalkCache.GetMetres(x, y));
 			}
 
 			file << row << "\n";
@@ -1200,7 +1092,7 @@ bool ParkController::SaveDistanceCache(const std::wstring file_name)
 
 			for (int x = 0; x < Rides.size() + 1; x++)
 			{
-				row += L"," + std::to_wstring(WalkTimeCache[x][y]);
+				row += L"," + std::to_wstring(WalkCache.GetMinutes(x, y));
 			}
 
 			file << row << "\n";
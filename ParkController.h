@@ -13,15 +13,21 @@
 #pragma once
 
 
+#include <memory>
 #include <string>
 #include <vector>
 
 
 #include "Constants.h"
+#include "DistanceMatrix.h"
 #include "Eatery.h"
+#include "EateryIndex.h"
+#include "MappedFile.h"
+#include "ParkImage.h"
 #include "RidePricing.h"
 #include "QWaitTypes.h"
 #include "Ride.h"
+#include "WalkwayGraph.h"
 
 
 const static int kSelectionChoiceCacheCount   = 200;
@@ -58,13 +64,21 @@ struct DistanceInfo {
 
 class ParkController
 {
+	friend bool ParkImage::Save(const std::wstring, ParkController&);
+	friend bool ParkImage::Load(const std::wstring, ParkController&);
+
 	bool ShowOutput;
 	bool FoodDrink = false;
 
 	std::vector<int> EntranceQueue;
 
-	int WalkTimeCache[Constants::MaxRideCount][Constants::MaxRideCount]; // not dynamic ;)
-	int WalkDistanceCache[Constants::MaxRideCount][Constants::MaxRideCount]; // not dynamic ;)
+	DistanceMatrix WalkCache;	// rides 0 to n - 1, the entrance is n
+
+	EateryIndex EateryLocations;
+
+	WalkwayGraph Walkways;
+
+	std::unique_ptr<MappedFile> ImageFile;	// the park image the walk cache is read from, if loaded from one
 
 	void BuildFromTemplate(ParkTemplate);
 
@@ -73,6 +87,10 @@ class ParkController
 	void BuildSelectionChoiceCache();
 	void BuildFastPassList();
 
+	uint64_t GetFingerprint();
+
+	void BuildDerivedData();
+
 	void UpdateThroughput();
 
 	void OutputStatus(std::wstring);
@@ -106,6 +124,7 @@ public:
 	bool BuildFromTemplate(const std::wstring);
 
 	void SaveAsTemplate(const std::wstring);
+	bool SaveAsImage(const std::wstring);
 
 	void AddNewRideContinuous(const std::wstring, int, RideExitType, int, int, int, int, int, int, bool, bool, bool);		// eg it's a small world
 	void AddNewRideShow(const std::wstring, int, RideExitType, int, int, int, int, int, int, int, int, bool, bool, bool);	// eg lion king show
@@ -125,6 +144,7 @@ public:
 
 	int GetDistanceBetweenInMinutes(int, int);
 	int GetDistanceBetweenInMetres(int, int);
+	int GetDistanceBetweenInTicks(int, int, int);
 
 	int GetMinuteCount();
 
@@ -138,5 +158,5 @@ public:
 
 	bool SaveDistanceCache(const std::wstring);
 
-	QWaitTypes::GetEatery GetClosestEatery(QWaitTypes::Coords, int);
+	QWaitTypes::GetEatery GetClosestEatery(QWaitTypes::Coords, int, int);
 };
\ No newline at end of file
@@ -0,0 +1,340 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "MappedFile.h"
+#include "ParkController.h"
+#include "ParkImage.h"
+
+
+namespace
+{
+	uint64_t Align(uint64_t offset, uint64_t alignment)
+	{
+		return (offset + alignment - 1) & ~(alignment - 1);
+	}
+
+
+	// the offset of a table of size bytes, moving offset past it
+	uint64_t Reserve(uint64_t& offset, uint64_t size)
+	{
+		uint64_t start = offset;
+
+		offset = Align(offset + size, 8);
+
+		return start;
+	}
+
+
+	void WriteAt(std::ofstream& file, uint64_t offset, const void* data, uint64_t size)
+	{
+		static const char zeroes[kDistanceMatrixAlignment] = { 0 };
+
+		while ((uint64_t)file.tellp() < offset)
+		{
+			file.write(zeroes, std::min((uint64_t)sizeof(zeroes), offset - (uint64_t)file.tellp()));
+		}
+
+		file.write(static_cast<const char*>(data), size);
+	}
+
+
+	std::wstring GetString(const uint32_t* offsets, const uint16_t* data, uint32_t index)
+	{
+		std::wstring output;
+
+		for (uint32_t c = offsets[index]; c < offsets[index + 1]; c++)
+		{
+			output += static_cast<wchar_t>(data[c]);
+		}
+
+		return output;
+	}
+}
+
+
+namespace ParkImage
+{
+	bool IsParkImage(const std::wstring file_name)
+	{
+		return std::filesystem::path(file_name).extension().wstring() == kParkImageExtension;
+	}
+
+
+	ParkImageLayout GetLayout(const ParkImageHeader& header)
+	{
+		ParkImageLayout layout;
+
+		uint64_t offset = Align(sizeof(ParkImageHeader), 8);
+
+		layout.Rides = Reserve(offset, (uint64_t)header.RideCount * sizeof(ParkImageRide));
+		layout.Eateries = Reserve(offset, (uint64_t)header.EateryCount * sizeof(ParkImageEatery));
+		layout.Closest = Reserve(offset, (uint64_t)header.RideCount * header.ClosestCount * sizeof(int32_t));
+		layout.StringOffsets = Reserve(offset, ((uint64_t)header.StringCount + 1) * sizeof(uint32_t));
+		layout.StringData = Reserve(offset, (uint64_t)header.StringUnits * sizeof(uint16_t));
+
+		layout.Walk = Align(offset, kDistanceMatrixAlignment);
+		layout.FileSize = layout.Walk + header.WalkBytes;
+
+		return layout;
+	}
+
+
+	bool Save(const std::wstring file_name, ParkController& park)
+	{
+		std::ofstream file(std::filesystem::path(file_name), std::ios::binary);
+
+		if (!file)
+		{
+			std::wcerr << L"Unable to save park image \"" << file_name << L"\"." << std::endl;
+
+			return false;
+		}
+
+		ParkImageHeader header;
+
+		memcpy(header.Magic, kParkImageMagic, sizeof(header.Magic));
+
+		header.RideCount = static_cast<uint32_t>(park.Rides.size());
+		header.EateryCount = static_cast<uint32_t>(park.Eateries.size());
+		header.ClosestCount = kClosestCacheSize;
+
+		header.EntranceX = park.entrance.position.x;
+		header.EntranceY = park.entrance.position.y;
+		header.FastPassType = park.entrance.fastPassType;
+		header.AverageVisitors = park.entrance.averageVisitors;
+		header.MaximumCapacity = park.entrance.maximumCapacity;
+
+		header.Prices[0] = park.entrance.Prices.Adult;
+		header.Prices[1] = park.entrance.Prices.AdultAdvance;
+		header.Prices[2] = park.entrance.Prices.Children;
+		header.Prices[3] = park.entrance.Prices.ChildrenAdvance;
+		header.Prices[4] = park.entrance.Prices.Babies;
+		header.Prices[5] = park.entrance.Prices.BabiesAdvance;
+
+		header.WalkBytes = park.WalkCache.GetByteCount();
+
+		std::vector<uint32_t> string_offsets;
+		std::vector<uint16_t> string_data;
+
+		string_offsets.push_back(0);
+
+		auto add_string = [&](const std::wstring& text) -> uint32_t
+		{
+			for (int c = 0; c < text.size(); c++)
+			{
+				string_data.push_back(static_cast<uint16_t>(text[c]));
+			}
+
+			string_offsets.push_back(static_cast<uint32_t>(string_data.size()));
+
+			return static_cast<uint32_t>(string_offsets.size() - 2);
+		};
+
+		add_string(park.entrance.ParkName);
+
+		std::vector<ParkImageRide> rides;
+		std::vector<int32_t> closest;
+
+		for (int r = 0; r < park.Rides.size(); r++)
+		{
+			Ride& ride = park.Rides[r];
+
+			ParkImageRide pir;
+
+			pir.Name = add_string(ride.RideOperation.name);
+			pir.Type = ride.RideOperation.rideTypeAsInt();
+			pir.ExitType = QWaitTypes::RideExitTypeToInt(ride.RideOperation.rideExitType);
+			pir.Length = ride.RideOperation.rideLength;
+			pir.ShowStartTime = ride.RideOperation.ShowStartTime;
+			pir.HourlyThroughput = ride.RideThroughput.totalPerHour;
+			pir.ShowCapacity = ride.RideThroughput.showCapacity;
+			pir.Popularity = ride.RideOperation.Popularity;
+			pir.X = ride.RideOperation.position.x;
+			pir.Y = ride.RideOperation.position.y;
+			pir.FastPassMode = ride.FastPass.parkMode;
+			pir.FastPassPercentage = ride.FastPass.percentage;
+			pir.TemplateID = ride.RideOperation.templateID;
+			pir.OwnHours = ride.RideOperation.ownHours ? 1 : 0;
+			pir.OpenHour = QWaitTypes::Hour(ride.RideOperation.open);
+			pir.OpenMinute = QWaitTypes::Minute(ride.RideOperation.open);
+			pir.CloseHour = QWaitTypes::Hour(ride.RideOperation.close);
+			pir.CloseMinute = QWaitTypes::Minute(ride.RideOperation.close);
+			pir.AdultValid = ride.RideOperation.AdultValid ? 1 : 0;
+			pir.ChildValid = ride.RideOperation.ChildValid ? 1 : 0;
+			pir.BabyValid = ride.RideOperation.BabyValid ? 1 : 0;
+
+			rides.push_back(pir);
+
+			closest.insert(closest.end(), ride.ClosestCache, ride.ClosestCache + kClosestCacheSize);
+		}
+
+		std::vector<ParkImageEatery> eateries;
+
+		for (int e = 0; e < park.Eateries.size(); e++)
+		{
+			Eatery& eatery = park.Eateries[e];
+
+			ParkImageEatery pie;
+
+			pie.Name = add_string(eatery.Name);
+			pie.Throughput = eatery.Throughput;
+			pie.X = eatery.X;
+			pie.Y = eatery.Y;
+			pie.WaitTime = eatery.GetWaitTimeSetting();
+			pie.AdultSpend = eatery.AveragePriceAdult;
+			pie.ChildSpend = eatery.AveragePriceChild;
+			pie.Food = eatery.Food ? 1 : 0;
+			pie.Drink = eatery.Drink ? 1 : 0;
+
+			eateries.push_back(pie);
+		}
+
+		header.StringCount = static_cast<uint32_t>(string_offsets.size() - 1);
+		header.StringUnits = static_cast<uint32_t>(string_data.size());
+
+		ParkImageLayout layout = GetLayout(header);
+
+		WriteAt(file, 0, &header, sizeof(header));
+		WriteAt(file, layout.Rides, rides.data(), rides.size() * sizeof(ParkImageRide));
+		WriteAt(file, layout.Eateries, eateries.data(), eateries.size() * sizeof(ParkImageEatery));
+		WriteAt(file, layout.Closest, closest.data(), closest.size() * sizeof(int32_t));
+		WriteAt(file, layout.StringOffsets, string_offsets.data(), string_offsets.size() * sizeof(uint32_t));
+		WriteAt(file, layout.StringData, string_data.data(), string_data.size() * sizeof(uint16_t));
+		const DistanceMatrix& walk = park.WalkCache;	// may be a view (built-in park or image), which only has const data
+
+		WriteAt(file, layout.Walk, walk.Data(), walk.GetByteCount());
+
+		return file.good();
+	}
+
+
+	// the park keeps the mapping open for the walk cache; everything else is copied out, as the simulation
+	// changes it
+	bool Load(const std::wstring file_name, ParkController& park)
+	{
+		std::unique_ptr<MappedFile> file = std::make_unique<MappedFile>(file_name);
+
+		if (!file->IsOpen())
+		{
+			std::wcerr << L"Unable to load park image \"" << file_name << L"\"." << std::endl;
+
+			return false;
+		}
+
+		ParkImageHeader header;
+
+		if (file->Size() < sizeof(header) || memcmp(file->Data(), kParkImageMagic, sizeof(header.Magic)) != 0)
+		{
+			std::wcerr << L"\"" << file_name << L"\" is not a QWait park image." << std::endl;
+
+			return false;
+		}
+
+		memcpy(&header, file->Data(), sizeof(header));
+
+		if (header.Version != kParkImageVersion)
+		{
+			std::wcerr << L"\"" << file_name << L"\" is park image version " << header.Version << L", expected " << kParkImageVersion << L". Use /compiletemplate to rebuild it." << std::endl;
+
+			return false;
+		}
+
+		ParkImageLayout layout = GetLayout(header);
+
+		uint64_t walk_bytes = 2 * (((uint64_t)header.RideCount + 1) * (header.RideCount + 2) / 2) * sizeof(uint16_t);
+
+		if (file->Size() < layout.FileSize || header.ClosestCount != kClosestCacheSize || header.WalkBytes != walk_bytes)
+		{
+			std::wcerr << L"\"" << file_name << L"\" is truncated or from an incompatible build. Use /compiletemplate to rebuild it." << std::endl;
+
+			return false;
+		}
+
+		const char* data = file->Data();
+
+		const ParkImageRide* rides = reinterpret_cast<const ParkImageRide*>(data + layout.Rides);
+		const ParkImageEatery* eateries = reinterpret_cast<const ParkImageEatery*>(data + layout.Eateries);
+		const int32_t* closest = reinterpret_cast<const int32_t*>(data + layout.Closest);
+		const uint32_t* string_offsets = reinterpret_cast<const uint32_t*>(data + layout.StringOffsets);
+		const uint16_t* string_data = reinterpret_cast<const uint16_t*>(data + layout.StringData);
+
+		park.SetEntrance(GetString(string_offsets, string_data, 0), header.EntranceX, header.EntranceY, header.FastPassType, header.AverageVisitors,
+			header.Prices[0], header.Prices[1], header.Prices[2], header.Prices[3], header.Prices[4], header.Prices[5], header.MaximumCapacity);
+
+		for (uint32_t r = 0; r < header.RideCount; r++)
+		{
+			const ParkImageRide& pir = rides[r];
+
+			std::wstring name = GetString(string_offsets, string_data, pir.Name);
+			RideExitType exit_type = QWaitTypes::IntToRideExitType(pir.ExitType);
+
+			if (pir.Type == 1)
+			{
+				if (pir.OwnHours)
+				{
+					park.AddNewRideShowWithHours(name, pir.Length, exit_type, pir.ShowStartTime, pir.HourlyThroughput, pir.ShowCapacity, pir.Popularity,
+						pir.OpenHour, pir.OpenMinute, pir.CloseHour, pir.CloseMinute, pir.X, pir.Y, pir.FastPassMode, pir.FastPassPercentage, pir.AdultValid, pir.ChildValid, pir.BabyValid);
+				}
+				else
+				{
+					park.AddNewRideShow(name, pir.Length, exit_type, pir.ShowStartTime, pir.HourlyThroughput, pir.ShowCapacity, pir.Popularity,
+						pir.X, pir.Y, pir.FastPassMode, pir.FastPassPercentage, pir.AdultValid, pir.ChildValid, pir.BabyValid);
+				}
+			}
+			else
+			{
+				if (pir.OwnHours)
+				{
+					park.AddNewRideContinuousWithHours(name, pir.Length, exit_type, pir.HourlyThroughput, pir.Popularity,
+						pir.OpenHour, pir.OpenMinute, pir.CloseHour, pir.CloseMinute, pir.X, pir.Y, pir.FastPassMode, pir.FastPassPercentage, pir.AdultValid, pir.ChildValid, pir.BabyValid);
+				}
+				else
+				{
+					park.AddNewRideContinuous(name, pir.Length, exit_type, pir.HourlyThroughput, pir.Popularity,
+						pir.X, pir.Y, pir.FastPassMode, pir.FastPassPercentage, pir.AdultValid, pir.ChildValid, pir.BabyValid);
+				}
+			}
+
+			Ride& ride = park.Rides.back();
+
+			ride.RideOperation.templateID = pir.TemplateID;
+
+			for (int c = 0; c < kClosestCacheSize; c++)
+			{
+				ride.ClosestCache[c] = closest[r * kClosestCacheSize + c];
+			}
+		}
+
+		park.UpdateThroughput();
+
+		for (uint32_t e = 0; e < header.EateryCount; e++)
+		{
+			const ParkImageEatery& pie = eateries[e];
+
+			park.AddFoodDrink(GetString(string_offsets, string_data, pie.Name), pie.Throughput, pie.Food, pie.Drink, pie.X, pie.Y, pie.WaitTime, pie.AdultSpend, pie.ChildSpend);
+		}
+
+		park.WalkCache.Share(reinterpret_cast<const uint16_t*>(data + layout.Walk), header.RideCount + 1);
+
+		park.ImageFile = std::move(file);
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+
+
+class ParkController;
+
+
+static const std::wstring kParkImageExtension = L".qwpark";	// /compiletemplate writes this, /templatefile loads it
+
+static const char kParkImageMagic[4] = { 'Q', 'W', 'P', 'I' };
+static const uint32_t kParkImageVersion = 1;
+
+
+struct ParkImageHeader {
+	char Magic[4];
+	uint32_t Version = kParkImageVersion;
+
+	uint32_t RideCount = 0;
+	uint32_t EateryCount = 0;
+	uint32_t ClosestCount = 0;		// kClosestCacheSize when written
+
+	uint32_t StringCount = 0;		// the park name, then each ride's name, then each eatery's
+	uint32_t StringUnits = 0;		// UTF-16 code units in the string table
+
+	int32_t EntranceX = 0;
+	int32_t EntranceY = 0;
+	int32_t FastPassType = 0;
+	int32_t AverageVisitors = 0;
+	int32_t MaximumCapacity = 0;
+
+	int32_t Prices[6] = { 0, 0, 0, 0, 0, 0 };	// adult, adult advance, child, child advance, baby, baby advance
+
+	uint64_t WalkBytes = 0;
+};
+
+
+// a ride as the park defines it, in popularity order. throughput and the opening hours (unless the ride
+// has its own) are applied when the image is loaded, as they depend on the run's settings
+struct ParkImageRide {
+	uint32_t Name = 0;				// string index
+	int32_t Type = 0;				// 0 continuous, 1 show
+	int32_t ExitType = 0;
+	int32_t Length = 0;
+	int32_t ShowStartTime = 0;
+	int32_t HourlyThroughput = 0;
+	int32_t ShowCapacity = 0;
+	int32_t Popularity = 0;
+	int32_t X = 0;
+	int32_t Y = 0;
+	int32_t FastPassMode = 0;		// as the park gives it
+	int32_t FastPassPercentage = 0;
+	int32_t TemplateID = 0;
+	int32_t OwnHours = 0;			// 1 = the ride opens and closes at the times below
+	int32_t OpenHour = 0;
+	int32_t OpenMinute = 0;
+	int32_t CloseHour = 0;
+	int32_t CloseMinute = 0;
+	uint8_t AdultValid = 0;
+	uint8_t ChildValid = 0;
+	uint8_t BabyValid = 0;
+	uint8_t Reserved = 0;
+};
+
+
+struct ParkImageEatery {
+	uint32_t Name = 0;
+	int32_t Throughput = 0;
+	int32_t X = 0;
+	int32_t Y = 0;
+	int32_t WaitTime = 0;
+	int32_t AdultSpend = 0;
+	int32_t ChildSpend = 0;
+	uint8_t Food = 0;
+	uint8_t Drink = 0;
+	uint8_t Reserved[2] = { 0, 0 };
+};
+
+
+// byte offsets of each table; every table starts on an 8 byte boundary, the walk cache on a cache line
+struct ParkImageLayout {
+	uint64_t Rides = 0;				// ParkImageRide per ride
+	uint64_t Eateries = 0;			// ParkImageEatery per eatery
+	uint64_t Closest = 0;			// int32_t, ClosestCount per ride
+	uint64_t StringOffsets = 0;		// uint32_t per string + 1
+	uint64_t StringData = 0;		// uint16_t
+	uint64_t Walk = 0;				// the walk cache exactly as DistanceMatrix holds it
+
+	uint64_t FileSize = 0;
+};
+
+
+// a park, built and sorted, with its walk cache and closest rides, saved as fixed width tables. the file is
+// mapped read-only and the walk cache (the only table that grows with the square of the park) is used in
+// place, so simulations of the same park running side by side share one copy of it
+namespace ParkImage
+{
+	bool IsParkImage(const std::wstring);
+
+	bool Save(const std::wstring, ParkController&);
+	bool Load(const std::wstring, ParkController&);
+
+	ParkImageLayout GetLayout(const ParkImageHeader&);
+}
\ No newline at end of file
@@ -0,0 +1,384 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Group.h"
+#include "MappedFile.h"
+#include "Names.h"
+#include "PopulationFile.h"
+#include "QWaitTypes.h"
+#include "Visitor.h"
+
+
+namespace
+{
+	uint64_t Align(uint64_t offset)
+	{
+		return (offset + 7) & ~static_cast<uint64_t>(7);
+	}
+
+
+	// the offset of a column of size bytes, moving offset past it
+	uint64_t Reserve(uint64_t& offset, uint64_t size)
+	{
+		uint64_t start = offset;
+
+		offset = Align(offset + size);
+
+		return start;
+	}
+
+
+	template <typename T>
+	void WriteColumn(std::ofstream& file, const std::vector<T>& column)
+	{
+		file.write(reinterpret_cast<const char*>(column.data()), column.size() * sizeof(T));
+
+		uint64_t padding = Align(column.size() * sizeof(T)) - column.size() * sizeof(T);
+
+		static const char zeroes[8] = { 0 };
+
+		file.write(zeroes, padding);
+	}
+
+
+	template <typename T>
+	const T* Column(const char* data, uint64_t offset)
+	{
+		return reinterpret_cast<const T*>(data + offset);
+	}
+}
+
+
+namespace PopulationFile
+{
+	bool IsPopulationFile(const std::wstring file_name)
+	{
+		return std::filesystem::path(file_name).extension().wstring() == kPopulationFileExtension;
+	}
+
+
+	bool Save(const std::wstring file_name, std::vector<Group>& groups, Names& names)
+	{
+		std::ofstream file(std::filesystem::path(file_name), std::ios::binary);
+
+		if (!file)
+		{
+			std::wcerr << L"Unable to save Visitor list file." << std::endl;
+
+			return false;
+		}
+
+		PopulationFileHeader header;
+
+		memcpy(header.Magic, kPopulationFileMagic, sizeof(header.Magic));
+
+		std::vector<uint8_t> group_type, group_template, group_stay, group_on_site, group_arrival, group_departure;
+		std::vector<uint32_t> group_first_visitor;
+
+		std::vector<uint8_t> visitor_type, visitor_age;
+		std::vector<uint16_t> visitor_first_name, visitor_last_name;
+		std::vector<double> visitor_max_wait, visitor_preference;
+
+		std::vector<uint32_t> string_offsets;
+		std::vector<uint16_t> string_data;
+
+		string_offsets.push_back(0);
+
+		for (const std::vector<std::wstring>* table : { &names.FirstNames(), &names.LastNames() })
+		{
+			for (int n = 0; n < table->size(); n++)
+			{
+				for (int c = 0; c < (*table)[n].size(); c++)
+				{
+					string_data.push_back(static_cast<uint16_t>((*table)[n][c]));
+				}
+
+				string_offsets.push_back(static_cast<uint32_t>(string_data.size()));
+			}
+		}
+
+		for (int g = 0; g < groups.size(); g++)
+		{
+			GroupConfiguration& config = groups[g].Configuration;
+
+			group_type.push_back(static_cast<uint8_t>(config.GetTypeToInt()));
+			group_template.push_back(static_cast<uint8_t>(config.templateID));
+			group_stay.push_back(static_cast<uint8_t>(config.stayDuration));
+			group_on_site.push_back(config.stayingOnSite ? 1 : 0);
+			group_arrival.push_back(static_cast<uint8_t>(QWaitTypes::Hour(config.arrivalTime)));
+			group_arrival.push_back(static_cast<uint8_t>(QWaitTypes::Minute(config.arrivalTime)));
+			group_departure.push_back(static_cast<uint8_t>(QWaitTypes::Hour(config.departureTime)));
+			group_departure.push_back(static_cast<uint8_t>(QWaitTypes::Minute(config.departureTime)));
+
+			group_first_visitor.push_back(static_cast<uint32_t>(visitor_type.size()));
+
+			for (int v = 0; v < groups[g].Visitors.size(); v++)
+			{
+				Visitor& visitor = groups[g].Visitors[v];
+
+				visitor_type.push_back(static_cast<uint8_t>(visitor.Configuration.GetTypeAsInt()));
+				visitor_age.push_back(static_cast<uint8_t>(visitor.Configuration.GetAgeAsInt()));
+				visitor_max_wait.push_back(visitor.Rides.maxWaitTime);
+				visitor_preference.push_back(visitor.Rides.preference);
+				visitor_first_name.push_back(visitor.Configuration.FirstName);
+				visitor_last_name.push_back(visitor.Configuration.LastName);
+			}
+		}
+
+		group_first_visitor.push_back(static_cast<uint32_t>(visitor_type.size()));
+
+		header.GroupCount = static_cast<uint32_t>(groups.size());
+		header.VisitorCount = static_cast<uint32_t>(visitor_type.size());
+		header.FirstNameCount = static_cast<uint32_t>(names.FirstNames().size());
+		header.LastNameCount = static_cast<uint32_t>(names.LastNames().size());
+		header.StringUnits = static_cast<uint32_t>(string_data.size());
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		static const char zeroes[8] = { 0 };
+
+		file.write(zeroes, Align(sizeof(header)) - sizeof(header));
+
+		// same order as GetLayout()
+		WriteColumn(file, group_type);
+		WriteColumn(file, group_template);
+		WriteColumn(file, group_stay);
+		WriteColumn(file, group_on_site);
+		WriteColumn(file, group_arrival);
+		WriteColumn(file, group_departure);
+		WriteColumn(file, group_first_visitor);
+
+		WriteColumn(file, visitor_type);
+		WriteColumn(file, visitor_age);
+		WriteColumn(file, visitor_first_name);
+		WriteColumn(file, visitor_last_name);
+		WriteColumn(file, visitor_max_wait);
+		WriteColumn(file, visitor_preference);
+
+		WriteColumn(file, string_offsets);
+		WriteColumn(file, string_data);
+
+		file.close();
+
+		return true;
+	}
+
+
+	// the columns are read directly from the mapped file, nothing is parsed or copied in to an
+	// intermediate buffer. returns the number of visitors loaded
+	int Load(const std::wstring file_name, std::vector<Group>& groups, Names& names)
+	{
+		MappedFile file(file_name);
+
+		if (!file.IsOpen())
+		{
+			std::wcerr << L"Unable to load visitors from file." << std::endl;
+
+			return 0;
+		}
+
+		PopulationFileHeader header;
+
+		if (file.Size() < sizeof(header))
+		{
+			std::wcerr << L"\"" << file_name << L"\" is not a QWait population file." << std::endl;
+
+			return 0;
+		}
+
+		memcpy(&header, file.Data(), sizeof(header));
+
+		if (memcmp(header.Magic, kPopulationFileMagic, sizeof(header.Magic)) != 0)
+		{
+			std::wcerr << L"\"" << file_name << L"\" is not a QWait population file." << std::endl;
+
+			return 0;
+		}
+
+		if (header.Version != kPopulationFileVersion)
+		{
+			std::wcerr << L"\"" << file_name << L"\" is population file version " << header.Version << L", expected " << kPopulationFileVersion << L"." << std::endl;
+
+			return 0;
+		}
+
+		PopulationFileLayout layout = GetLayout(header);
+
+		if (file.Size() < layout.FileSize)
+		{
+			std::wcerr << L"\"" << file_name << L"\" is truncated." << std::endl;
+
+			return 0;
+		}
+
+		const char* data = file.Data();
+
+		const uint8_t* group_type = Column<uint8_t>(data, layout.GroupType);
+		const uint8_t* group_template = Column<uint8_t>(data, layout.GroupTemplate);
+		const uint8_t* group_stay = Column<uint8_t>(data, layout.GroupStayDuration);
+		const uint8_t* group_on_site = Column<uint8_t>(data, layout.GroupOnSite);
+		const uint8_t* group_arrival = Column<uint8_t>(data, layout.GroupArrival);
+		const uint8_t* group_departure = Column<uint8_t>(data, layout.GroupDeparture);
+		const uint32_t* group_first_visitor = Column<uint32_t>(data, layout.GroupFirstVisitor);
+
+		const uint8_t* visitor_type = Column<uint8_t>(data, layout.VisitorType);
+		const uint8_t* visitor_age = Column<uint8_t>(data, layout.VisitorAge);
+		const uint16_t* visitor_first_name = Column<uint16_t>(data, layout.VisitorFirstName);
+		const uint16_t* visitor_last_name = Column<uint16_t>(data, layout.VisitorLastName);
+		const double* visitor_max_wait = Column<double>(data, layout.VisitorMaxWaitTime);
+		const double* visitor_preference = Column<double>(data, layout.VisitorPreference);
+
+		const uint32_t* string_offsets = Column<uint32_t>(data, layout.StringOffsets);
+		const uint16_t* string_data = Column<uint16_t>(data, layout.StringData);
+
+		// check every index before anything is built, so a damaged file can't read outside the view
+		uint32_t string_count = header.FirstNameCount + header.LastNameCount;
+
+		if (group_first_visitor[header.GroupCount] != header.VisitorCount || string_offsets[string_count] != header.StringUnits ||
+			header.FirstNameCount > kNoName || header.LastNameCount > kNoName)
+		{
+			std::wcerr << L"\"" << file_name << L"\" is damaged." << std::endl;
+
+			return 0;
+		}
+
+		for (uint32_t g = 0; g < header.GroupCount; g++)
+		{
+			if (group_first_visitor[g] > group_first_visitor[g + 1])
+			{
+				std::wcerr << L"\"" << file_name << L"\" is damaged." << std::endl;
+
+				return 0;
+			}
+		}
+
+		for (uint32_t s = 0; s < string_count; s++)
+		{
+			if (string_offsets[s] > string_offsets[s + 1])
+			{
+				std::wcerr << L"\"" << file_name << L"\" is damaged." << std::endl;
+
+				return 0;
+			}
+		}
+
+		for (uint32_t v = 0; v < header.VisitorCount; v++)
+		{
+			bool no_name = visitor_first_name[v] == kNoName;
+
+			if (!no_name && (visitor_first_name[v] >= header.FirstNameCount || visitor_last_name[v] >= header.LastNameCount))
+			{
+				std::wcerr << L"\"" << file_name << L"\" is damaged." << std::endl;
+
+				return 0;
+			}
+		}
+
+		std::vector<std::wstring> first_names, last_names;
+
+		for (uint32_t s = 0; s < string_count; s++)
+		{
+			std::vector<std::wstring>& table = (s < header.FirstNameCount) ? first_names : last_names;
+
+			table.emplace_back(string_data + string_offsets[s], string_data + string_offsets[s + 1]);
+		}
+
+		names.SetNames(std::move(first_names), std::move(last_names));
+
+		groups.reserve(groups.size() + header.GroupCount);
+
+		for (uint32_t g = 0; g < header.GroupCount; g++)
+		{
+			groups.emplace_back(group_type[g], group_template[g], group_stay[g], group_on_site[g] != 0,
+				group_arrival[g * 2], group_arrival[g * 2 + 1], group_departure[g * 2], group_departure[g * 2 + 1]);
+
+			Group& group = groups.back();
+
+			group.Visitors.reserve(group_first_visitor[g + 1] - group_first_visitor[g]);
+
+			for (uint32_t v = group_first_visitor[g]; v < group_first_visitor[g + 1]; v++)
+			{
+				NewVisitorConfiguration config;
+
+				config.type = QWaitTypes::IntToVisitorType(visitor_type[v]);
+
+				switch (visitor_age[v])
+				{
+				case 0:
+					config.age = AgeGroup::Baby;
+					break;
+				case 1:
+					config.age = AgeGroup::Child;
+					break;
+				case 2:
+					config.age = AgeGroup::Adult;
+					break;
+				}
+
+				config.maxWaitTime = visitor_max_wait[v];
+				config.preference = visitor_preference[v];
+
+				group.Visitors.emplace_back(config);
+
+				group.Visitors.back().Configuration.FirstName = visitor_first_name[v];
+				group.Visitors.back().Configuration.LastName = visitor_last_name[v];
+			}
+
+			group.VisitorsLoaded();
+		}
+
+		return static_cast<int>(header.VisitorCount);
+	}
+
+
+	namespace
+	{
+		PopulationFileLayout GetLayout(const PopulationFileHeader& header)
+		{
+			PopulationFileLayout layout;
+
+			uint64_t groups = header.GroupCount;
+			uint64_t visitors = header.VisitorCount;
+
+			uint64_t offset = Align(sizeof(PopulationFileHeader));
+
+			layout.GroupType = Reserve(offset, groups);
+			layout.GroupTemplate = Reserve(offset, groups);
+			layout.GroupStayDuration = Reserve(offset, groups);
+			layout.GroupOnSite = Reserve(offset, groups);
+			layout.GroupArrival = Reserve(offset, groups * 2);
+			layout.GroupDeparture = Reserve(offset, groups * 2);
+			layout.GroupFirstVisitor = Reserve(offset, (groups + 1) * sizeof(uint32_t));
+
+			layout.VisitorType = Reserve(offset, visitors);
+			layout.VisitorAge = Reserve(offset, visitors);
+			layout.VisitorFirstName = Reserve(offset, visitors * sizeof(uint16_t));
+			layout.VisitorLastName = Reserve(offset, visitors * sizeof(uint16_t));
+			layout.VisitorMaxWaitTime = Reserve(offset, visitors * sizeof(double));
+			layout.VisitorPreference = Reserve(offset, visitors * sizeof(double));
+
+			layout.StringOffsets = Reserve(offset, ((uint64_t)header.FirstNameCount + header.LastNameCount + 1) * sizeof(uint32_t));
+			layout.StringData = Reserve(offset, (uint64_t)header.StringUnits * sizeof(uint16_t));
+
+			layout.FileSize = offset;
+
+			return layout;
+		}
+	}
+}
\ No newline at end of file
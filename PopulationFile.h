@@ -0,0 +1,79 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Group.h"
+#include "Names.h"
+
+
+static const std::wstring kPopulationFileExtension = L".qwp";	// /reportvisitordemo and /importvisitordemo use the binary format for this extension
+
+static const char kPopulationFileMagic[4] = { 'Q', 'W', 'P', 'F' };
+static const uint32_t kPopulationFileVersion = 2;	// 2: names stored as first/last name indices
+
+
+struct PopulationFileHeader {
+	char Magic[4];
+	uint32_t Version = kPopulationFileVersion;
+
+	uint32_t GroupCount = 0;
+	uint32_t VisitorCount = 0;
+
+	uint32_t FirstNameCount = 0;	// the string table holds the first names, then the surnames
+	uint32_t LastNameCount = 0;
+	uint32_t StringUnits = 0;		// UTF-16 code units in the string table
+};
+
+
+// byte offsets of each column; every column starts on an 8 byte boundary
+struct PopulationFileLayout {
+	uint64_t GroupType = 0;				// uint8_t per group
+	uint64_t GroupTemplate = 0;			// uint8_t
+	uint64_t GroupStayDuration = 0;		// uint8_t
+	uint64_t GroupOnSite = 0;			// uint8_t
+	uint64_t GroupArrival = 0;			// uint8_t hours, uint8_t minutes
+	uint64_t GroupDeparture = 0;		// uint8_t hours, uint8_t minutes
+	uint64_t GroupFirstVisitor = 0;		// uint32_t per group + 1, the group's visitors are [n, n + 1)
+
+	uint64_t VisitorType = 0;			// uint8_t per visitor
+	uint64_t VisitorAge = 0;			// uint8_t
+	uint64_t VisitorFirstName = 0;		// uint16_t first name index (kNoName for none)
+	uint64_t VisitorLastName = 0;		// uint16_t surname index
+	uint64_t VisitorMaxWaitTime = 0;	// double
+	uint64_t VisitorPreference = 0;		// double
+
+	uint64_t StringOffsets = 0;			// uint32_t per string + 1
+	uint64_t StringData = 0;			// uint16_t
+
+	uint64_t FileSize = 0;
+};
+
+
+// the population as fixed width columns with an interned name table, read straight from a mapped view
+namespace PopulationFile
+{
+	bool IsPopulationFile(const std::wstring);
+
+	bool Save(const std::wstring, std::vector<Group>&, Names&);
+	int Load(const std::wstring, std::vector<Group>&, Names&);
+
+	namespace
+	{
+		PopulationFileLayout GetLayout(const PopulationFileHeader&);
+	}
+}
\ No newline at end of file
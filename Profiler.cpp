@@ -0,0 +1,189 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "Profiler.h"
+
+
+Profiler* GProfiler;
+
+
+namespace
+{
+	const std::wstring kSectionNames[kProfileSectionCount] = { L"Visitor generation", L"Build rides", L"Pre-arrival fastpass", L"Day", L"Group countdowns", L"Entrance", L"Rides", L"Eateries",
+		                                                       L"Visitor location", L"Minute statistics", L"Reports" };
+
+	// by GroupParkStatus
+	const std::wstring kGroupStatusNames[kProfileGroupStatusCount] = { L"On way", L"At entrance", L"Idle", L"Riding", L"Queuing", L"Queuing fastpass", L"Queuing food",
+		                                                               L"Travelling to ride", L"Waiting", L"Travelling to food", L"Eating", L"Exited" };
+
+	double Seconds(int64_t nanoseconds)
+	{
+		return (double)nanoseconds / 1000000000.0;
+	}
+
+	std::wstring Row(const std::wstring name, const ProfileTiming& timing, int64_t day)
+	{
+		std::wostringstream row;
+
+		row << L"  " << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(3) << std::setw(10) << Seconds(timing.nanoseconds);
+
+		if (day > 0)
+		{
+			row << std::setprecision(1) << std::setw(9) << 100.0 * (double)timing.nanoseconds / (double)day << L"%";
+		}
+		else
+		{
+			row << std::setw(10) << L"";
+		}
+
+		row << std::setw(12) << timing.calls;
+
+		return row.str();
+	}
+}
+
+
+Profiler::Profiler(bool enabled)
+{
+	Enabled = enabled;
+}
+
+
+// the parts of the day that are timed; the rest of Day is the loop itself and the clock
+int64_t Profiler::DayAccounted()
+{
+	int64_t total = 0;
+
+	for (int s = static_cast<int>(ProfileSection::GroupCountdowns); s <= static_cast<int>(ProfileSection::MinuteStats); s++)
+	{
+		total += Sections[s].nanoseconds;
+	}
+
+	for (int g = 0; g < kProfileGroupStatusCount; g++)
+	{
+		total += GroupStatus[g].nanoseconds;
+	}
+
+	return total;
+}
+
+
+// reports run on several threads; the time is each report's own, not wall clock
+void Profiler::AddReport(const std::wstring name, double seconds)
+{
+	std::lock_guard<std::mutex> lock(ReportLock);
+
+	ProfileReport report;
+
+	report.name = name;
+	report.timing.nanoseconds = static_cast<int64_t>(seconds * 1000000000.0);
+	report.timing.calls = 1;
+
+	Reports.push_back(report);
+}
+
+
+void Profiler::ShowResults()
+{
+	int64_t day = Sections[static_cast<int>(ProfileSection::Day)].nanoseconds;
+
+	std::wcout << L"\n  Profile                             Time (s)  % of day       Calls\n";
+	std::wcout << L"  ---------------------------------------------------------------------\n";
+
+	for (int s = static_cast<int>(ProfileSection::VisitorGeneration); s <= static_cast<int>(ProfileSection::PreArrivalFastPass); s++)
+	{
+		if (Sections[s].calls != 0)
+		{
+			std::wcout << Row(kSectionNames[s], Sections[s], 0) << L"\n";
+		}
+	}
+
+	std::wcout << Row(kSectionNames[static_cast<int>(ProfileSection::Day)], Sections[static_cast<int>(ProfileSection::Day)], day) << L"\n";
+
+	std::wcout << Row(L"  " + kSectionNames[static_cast<int>(ProfileSection::GroupCountdowns)], Sections[static_cast<int>(ProfileSection::GroupCountdowns)], day) << L"\n";
+
+	for (int g = 0; g < kProfileGroupStatusCount; g++)
+	{
+		if (GroupStatus[g].calls != 0)
+		{
+			std::wcout << Row(L"  Group: " + kGroupStatusNames[g], GroupStatus[g], day) << L"\n";
+		}
+	}
+
+	for (int s = static_cast<int>(ProfileSection::Entrance); s <= static_cast<int>(ProfileSection::MinuteStats); s++)
+	{
+		if (Sections[s].calls != 0)
+		{
+			std::wcout << Row(L"  " + kSectionNames[s], Sections[s], day) << L"\n";
+		}
+	}
+
+	ProfileTiming other;
+
+	other.nanoseconds = day - DayAccounted();
+
+	std::wcout << Row(L"  Other", other, day) << L"\n";
+
+	std::wcout << Row(kSectionNames[static_cast<int>(ProfileSection::Reports)], Sections[static_cast<int>(ProfileSection::Reports)], 0) << L"\n";
+
+	for (int r = 0; r < Reports.size(); r++)
+	{
+		std::wcout << Row(L"  " + Reports[r].name, Reports[r].timing, 0) << L"\n";
+	}
+
+	std::wcout << std::endl;
+}
+
+
+bool Profiler::SaveCSV(const std::wstring file_name)
+{
+	std::wofstream file(file_name);
+
+	if (file)
+	{
+		file << L"section,subsection,seconds,calls\n";
+
+		for (int s = 0; s < kProfileSectionCount; s++)
+		{
+			file << kSectionNames[s] << L",," << std::fixed << std::setprecision(6) << Seconds(Sections[s].nanoseconds) << L"," << Sections[s].calls << L"\n";
+
+			if (s == static_cast<int>(ProfileSection::Day))
+			{
+				for (int g = 0; g < kProfileGroupStatusCount; g++)
+				{
+					if (GroupStatus[g].calls != 0)
+					{
+						file << L"Group," << kGroupStatusNames[g] << L"," << Seconds(GroupStatus[g].nanoseconds) << L"," << GroupStatus[g].calls << L"\n";
+					}
+				}
+			}
+		}
+
+		for (int r = 0; r < Reports.size(); r++)
+		{
+			file << L"Report," << Reports[r].name << L"," << Seconds(Reports[r].timing.nanoseconds) << L"," << Reports[r].timing.calls << L"\n";
+		}
+
+		file.close();
+
+		return true;
+	}
+
+	std::wcerr << L"Unable to save profile \"" << file_name << L"\"." << std::endl;
+
+	return false;
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+enum class GroupParkStatus;
+
+
+enum class ProfileSection { VisitorGeneration = 0, BuildRides = 1, PreArrivalFastPass = 2, Day = 3, GroupCountdowns = 4, Entrance = 5, Rides = 6, Eateries = 7,
+	                        VisitorLocation = 8, MinuteStats = 9, Reports = 10 };
+
+static const int kProfileSectionCount = 11;
+static const int kProfileGroupStatusCount = 12;		// one per GroupParkStatus
+
+
+struct ProfileTiming {
+	int64_t nanoseconds = 0;
+	int64_t calls = 0;
+};
+
+
+struct ProfileReport {
+	std::wstring name = L"";
+
+	ProfileTiming timing;
+};
+
+
+// where a run's time goes: the startup stages, each part of the engine's day (group decisions split by
+// the group's status), and each report. the startup stages and reports are always timed, they happen
+// once; the day is only timed by the engine's profiling instantiation (/profile), so an ordinary run
+// pays nothing for it
+class Profiler
+{
+	std::mutex ReportLock;
+
+	ProfileTiming Sections[kProfileSectionCount];
+	ProfileTiming GroupStatus[kProfileGroupStatusCount];
+
+	std::vector<ProfileReport> Reports;
+
+	int64_t DayAccounted();
+
+public:
+
+	bool Enabled = false;
+
+	Profiler(bool);
+
+	static int64_t Now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// these run for every group decision, so they're here where the engine's loop can inline them
+	void Add(ProfileSection section, int64_t start)
+	{
+		Sections[static_cast<int>(section)].nanoseconds += Now() - start;
+		Sections[static_cast<int>(section)].calls++;
+	}
+
+	void Add(GroupParkStatus status, int64_t start)
+	{
+		GroupStatus[static_cast<int>(status)].nanoseconds += Now() - start;
+		GroupStatus[static_cast<int>(status)].calls++;
+	}
+
+	void AddReport(const std::wstring, double);
+
+	void ShowResults();
+	bool SaveCSV(const std::wstring);
+};
+
+
+extern Profiler* GProfiler;
+
+
+// times the enclosing block in to a section (or a group status); ProfileScope<false> does nothing, so
+// the engine can leave its timers in place in the instantiations that don't profile
+template <bool Enabled>
+class ProfileScope
+{
+	int64_t Start;
+
+	ProfileSection Section = ProfileSection::Day;
+	GroupParkStatus Status{};
+
+	bool IsGroup = false;
+
+public:
+
+	ProfileScope(ProfileSection section) : Start(Profiler::Now()), Section(section)
+	{
+	}
+
+	ProfileScope(GroupParkStatus status) : Start(Profiler::Now()), Status(status), IsGroup(true)
+	{
+	}
+
+	~ProfileScope()
+	{
+		if (IsGroup)
+		{
+			GProfiler->Add(Status, Start);
+		}
+		else
+		{
+			GProfiler->Add(Section, Start);
+		}
+	}
+};
+
+
+template <>
+class ProfileScope<false>
+{
+public:
+
+	ProfileScope(ProfileSection)
+	{
+	}
+
+	ProfileScope(GroupParkStatus)
+	{
+	}
+};
\ No newline at end of file
@@ -14,11 +14,13 @@
 #include <iostream>
 #include <string.h>
 
+#include "Benchmark.h"
 #include "Configuration.h"
 #include "Engine.h"
 #include "Help.h"
 #include "GlobalController.h"
 #include "ParkController.h"
+#include "Profiler.h"
 #include "ReportController.h"
 #include "Utility.h"
 #include "VisitorController.h"
@@ -56,57 +58,78 @@ int DoWeJustNeedToShowHelp(int argc, wchar_t* argv[])
 }
 
 
+// each report only reads the finished simulation, so they are queued as independent
+// tasks and generated concurrently; RunTasks() returns once every report has been written
 void CreateOutput()
 {
+    std::wstring file_prefix = Utility::DateTime(kDisplayModeFile);
+
+    std::wstring csv_extension = GConfiguration->CSVReports.Compress ? L".csv.gz" : L".csv";
+
     if (GConfiguration->DebugReports.SelectionChoiceCache)
     {
-        GReportController->SaveSelectionChoiceCacheCSV(Utility::DateTime(kDisplayModeFile) + L"_sscc.csv");
+        GReportController->AddTask(L"Selection choice cache", [file_prefix]() { GReportController->SaveSelectionChoiceCacheCSV(file_prefix + L"_sscc.csv"); });
     }
 
     if (GConfiguration->DebugReports.DistanceCache)
     {
-        GParkController->SaveDistanceCache(Utility::DateTime(kDisplayModeFile) + L"_dctc.csv");
+        GReportController->AddTask(L"Distance cache", [file_prefix]() { GParkController->SaveDistanceCache(file_prefix + L"_dctc.csv"); });
     }
 
     // ==========================================================================================
 
     if (GConfiguration->CSVReports.CompleteVisitorData)
     {
-        GReportController->SaveVisitorDataCSV(Utility::DateTime(kDisplayModeFile) + L"_visitors.csv");
+        GReportController->AddTask(L"Visitor data CSV", [file_prefix, csv_extension]() { GReportController->SaveVisitorDataCSV(file_prefix + L"_visitors" + csv_extension); });
     }
 
     if (GConfiguration->CSVReports.MinuteByMinute)
     {
-        GReportController->SaveMinuteByMinuteLogCSV(Utility::DateTime(kDisplayModeFile) + L"_mxm.csv");
+        GReportController->AddTask(L"Minute-by-minute CSV", [file_prefix, csv_extension]() { GReportController->SaveMinuteByMinuteLogCSV(file_prefix + L"_mxm" + csv_extension); });
     }
 
     if (GConfiguration->CSVReports.VisitorLocation)
     {
-        GReportController->SaveVisitorLocationCSV(Utility::DateTime(kDisplayModeFile) + L"_location.csv");
+        GReportController->AddTask(L"Visitor location CSV", [file_prefix, csv_extension]() { GReportController->SaveVisitorLocationCSV(file_prefix + L"_location" + csv_extension); });
     }
 
     if (GConfiguration->CSVReports.VisitorRideList)
     {
-        GReportController->SaveVisitorRideListCSV(Utility::DateTime(kDisplayModeFile) + L"_ridelist.csv");
+        GReportController->AddTask(L"Visitor ride list CSV", [file_prefix, csv_extension]() { GReportController->SaveVisitorRideListCSV(file_prefix + L"_ridelist" + csv_extension); });
     }
 
     // ==========================================================================================
 
     if (GConfiguration->HTMLReports.SimulationReport)
     {
-        GReportController->SaveSimulationReportHTML(GConfiguration->HTMLReports.SimulationReportFile, GConfiguration->FastPassMode);
+        GReportController->AddTask(L"Simulation report HTML", []() { GReportController->SaveSimulationReportHTML(GConfiguration->HTMLReports.SimulationReportFile, GConfiguration->FastPassMode); });
     }
 
     // ==========================================================================================
 
     if (GConfiguration->TextReports.MinuteByMinute)
     {
-        GReportController->SaveMXMReportText(Utility::DateTime(kDisplayModeFile) + L"_mxm.txt", GConfiguration->FastPassMode);
+        GReportController->AddTask(L"Minute-by-minute text", [file_prefix]() { GReportController->SaveMXMReportText(file_prefix + L"_mxm.txt", GConfiguration->FastPassMode); });
     }
 
     if (GConfiguration->TextReports.SimulationReport)
     {
-        GReportController->SaveSimulationReportText(Utility::DateTime(kDisplayModeFile) + L"_sim.txt", GConfiguration->FastPassMode);
+        GReportController->AddTask(L"Simulation report text", [file_prefix]() { GReportController->SaveSimulationReportText(file_prefix + L"_sim.txt", GConfiguration->FastPassMode); });
+    }
+
+    // ==========================================================================================
+
+    {
+        ProfileScope<true> timer(ProfileSection::Reports);
+
+        GReportController->RunTasks();
+    }
+
+    if (GConfiguration->DebugConfig.Profile)
+    {
+        GProfiler->ShowResults();
+
+        GProfiler->SaveCSV(file_prefix + L"_profile.csv");
     }
 }
 
@@ -139,11 +162,48 @@ int wmain(int argc, wchar_t* argv[])
     // ==========================================================================================
 
     GlobalControllers::CreateGlobalControllers(argc, argv);
+
+    if (GConfiguration->Input.ExpandList)
+    {
+        int result = GReportController->ExpandEncodedListCSV(GConfiguration->Input.ExpandListFile) ? 0 : 1;
+
+        GlobalControllers::FreeGlobalControllers();
+
+        return result;
+    }
+
+    if (GConfiguration->DebugConfig.Benchmark)
+    {
+        Benchmark::Run();
+
+        GlobalControllers::FreeGlobalControllers();
+
+        return 0;
+    }
+
+    if (GConfiguration->Input.CompileTemplate)
+    {
+        GParkController->BuildRides(GConfiguration->RideTemplate, GConfiguration->RideTemplateFile);
+
+        int result = GParkController->SaveAsImage(GConfiguration->Input.CompileTemplateFile) ? 0 : 1;
+
+        GlobalControllers::FreeGlobalControllers();
+
+        return result;
+    }
         
-    GVisitorController->Run(GConfiguration->CSVReports.VisitorDemographics, GConfiguration->CSVReports.VisitorDemographicsFile,
-                            GConfiguration->Input.VisitorDemographics, GConfiguration->Input.VisitorDemographicsFile);
+    {
+        ProfileScope<true> timer(ProfileSection::VisitorGeneration);
+
+        GVisitorController->Run(GConfiguration->CSVReports.VisitorDemographics, GConfiguration->CSVReports.VisitorDemographicsFile,
+                                GConfiguration->Input.VisitorDemographics, GConfiguration->Input.VisitorDemographicsFile);
+    }
+
+    {
+        ProfileScope<true> timer(ProfileSection::BuildRides);
 
-    GParkController->BuildRides(GConfiguration->RideTemplate, GConfiguration->RideTemplateFile);
+        GParkController->BuildRides(GConfiguration->RideTemplate, GConfiguration->RideTemplateFile);
+    }
 
     // ==========================================================================================
 
@@ -157,7 +217,8 @@ int wmain(int argc, wchar_t* argv[])
                 !GConfiguration->DebugConfig.DisableConsoleOutput, 
                 GConfiguration->DebugConfig.UpdateRate,
                 GConfiguration->HandleFoodDrink,
-                GConfiguration->Climate.Temperature);
+                GConfiguration->Climate.Temperature,
+                GConfiguration->TickSeconds);
 
             e.Run(GConfiguration->CSVReports.MinuteByMinute || GConfiguration->HTMLReports.SimulationReport || GConfiguration->TextReports.MinuteByMinute, GConfiguration->CSVReports.VisitorLocation);
         }
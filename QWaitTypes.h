@@ -13,6 +13,7 @@
 #pragma once
 
 
+#include <cstdint>
 #include <vector>
 
 #include "Constants.h"
@@ -25,7 +26,7 @@ enum class RideExitType { None, Short, Long, Shop, LargeShop };
 //                                            visitors staying onsite do not get first pick on fastpass tickets
 enum class FastPassType { None = 0, Plus = 1, PlusNoStayBenefit = 2 };
 
-enum class VisitorType {
+enum class VisitorType : uint8_t {
 	Enthusiast = 0, Fan = 1, Tourist = 2, Activity = 3,
 	Passholder = 4, EPassHolder = 5, TikToker = 6, VIP = 7
 };
@@ -43,16 +44,20 @@ namespace QWaitTypes
 		int y = 0;
 	};
 
-	struct Time {
-		int hours = 0;
-		int minutes = 0;
-	};
+	// a time of day as the minute of the day (hours * 60 + minutes). the engine's clock, visitor arrival and
+	// departure, ride opening hours and fastpass tickets all use it, so time checks are a single compare;
+	// it's only split in to hours and minutes for display and for the file formats
+	typedef int Time;
+
+	constexpr Time MakeTime(int hours, int minutes) { return hours * 60 + minutes; }
+	constexpr int Hour(Time time) { return time / 60; }
+	constexpr int Minute(Time time) { return time % 60; }
 
 	struct FastPass {
 		int type = 0;		// 1, 2, or 3
 		int ride = 0;
 
-		Time ticket = { 0, 0 };
+		Time ticket = 0;
 	};
 
 	struct GetRide {
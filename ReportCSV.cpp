@@ -10,12 +10,18 @@
 // =======================================================================
 
 
+#include <charconv>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <string_view>
 
 #include "Configuration.h"
 #include "ParkController.h"
+#include "ReportController.h"
 #include "ReportCSV.h"
+#include "ReportWriter.h"
 #include "VisitorController.h"
 
 
@@ -23,13 +29,14 @@ extern ParkController* GParkController;
 extern VisitorController* GVisitorController;
 
 extern Configuration* GConfiguration;
+extern ReportController* GReportController;
 
 
 namespace ReportCSV
 {
 	void ReportCSV::SaveRideData(const std::wstring file_name)
 	{
-		std::wofstream file(file_name);
+		ReportWriter file(file_name);
 
 		if (file)
 		{
@@ -40,7 +47,7 @@ namespace ReportCSV
 				file << GParkController->Rides[r].RideOperation.name << "," << GParkController->Rides[r].DailyStatistics.totalRiders << "\n";
 			}
 
-			file.close();
+			file.Close();
 		}
 		else
 		{
@@ -51,7 +58,7 @@ namespace ReportCSV
 
 	void ReportCSV::SaveVisitorData(const std::wstring file_name)
 	{
-		std::wofstream file(file_name);
+		ReportWriter file(file_name);
 
 		if (file)
 		{
@@ -67,37 +74,40 @@ namespace ReportCSV
 				file << "Group,Group Type,Name,Spent,Type,Distance Travelled,Distance Travelled per ride,Time spent queuing,Time spent travelling,Time riding,Ride count,Queuing+Travelling/Riding Time,No ride available,Wait time too long,Shutdown,Shortest queue,longest queue,Fastpass rides" << "\n";
 			}
 
-			for (int g = 0; g < GVisitorController->Groups.size(); g++)
-			{
-				for (int v = 0; v < GVisitorController->Groups[g].Visitors.size(); v++)
+			file.WriteChunked(GVisitorController->Groups.size(), kVisitorDataGroupsPerChunk, [](ReportWriter& chunk, size_t first, size_t last)
 				{
-					Visitor vx = GVisitorController->Groups[g].Visitors[v];
-
-					double dtbrc = 0;
-					double tqttbtr = 0;
-
-					if (vx.Rides.count != 0)
+					for (size_t g = first; g < last; g++)
 					{
-						dtbrc = (double)vx.Rides.distanceTravelled / (double)vx.Rides.count;
-					}
-
-					if (vx.TimeSpent.riding != 0)
-					{
-						tqttbtr = (double)(vx.TimeSpent.queuing + (double)vx.TimeSpent.travelling) / (double)vx.TimeSpent.riding;
-					}
-
-					if (GConfiguration->HandleFoodDrink)
-					{
-						file << g << "," << GVisitorController->Groups[g].Configuration.GetTypeToInt() << L"," << vx.Configuration.Name << L"," << vx.Configuration.MoneySpent << "," << vx.Configuration.TypeInt << "," << vx.Rides.distanceTravelled << "," << dtbrc << "," << vx.TimeSpent.queuing << "," << vx.TimeSpent.travelling << "," << vx.TimeSpent.riding << "," << vx.Rides.count << "," << tqttbtr << "," << vx.Rides.noRideAvailable << "," << vx.Rides.waitTimeTooLong << "," << vx.Rides.rideShutdown << "," << vx.Rides.eateryQueueTooLong << "," << vx.Rides.shortestQueue << "," << vx.Rides.longestQueue << "," << vx.Rides.fastPassRides << "\n";
-					}
-					else
-					{
-						file << g << "," << GVisitorController->Groups[g].Configuration.GetTypeToInt() << L"," << vx.Configuration.Name << L"," << vx.Configuration.MoneySpent << "," << vx.Configuration.TypeInt << "," << vx.Rides.distanceTravelled << "," << dtbrc << "," << vx.TimeSpent.queuing << "," << vx.TimeSpent.travelling << "," << vx.TimeSpent.riding << "," << vx.Rides.count << "," << tqttbtr << "," << vx.Rides.noRideAvailable << "," << vx.Rides.waitTimeTooLong << "," << vx.Rides.rideShutdown << "," << vx.Rides.shortestQueue << "," << vx.Rides.longestQueue << "," << vx.Rides.fastPassRides << "\n";
+						for (int v = 0; v < GVisitorController->Groups[g].Visitors.size(); v++)
+						{
+							const Visitor& vx = GVisitorController->Groups[g].Visitors[v];
+
+							double dtbrc = 0;
+							double tqttbtr = 0;
+
+							if (vx.Rides.count != 0)
+							{
+								dtbrc = (double)vx.Rides.distanceTravelled / (double)vx.Rides.count;
+							}
+
+							if (vx.TimeSpent.riding != 0)
+							{
+								tqttbtr = (double)(vx.TimeSpent.queuing + (double)vx.TimeSpent.travelling) / (double)vx.TimeSpent.riding;
+							}
+
+							if (GConfiguration->HandleFoodDrink)
+							{
+								chunk << g << "," << GVisitorController->Groups[g].Configuration.GetTypeToInt() << L"," << GVisitorController->GetVisitorFullName(vx) << L"," << vx.Configuration.MoneySpent << "," << vx.Configuration.GetTypeAsInt() << "," << vx.Rides.distanceTravelled << "," << dtbrc << "," << vx.TimeSpent.queuing << "," << vx.TimeSpent.travelling << "," << vx.TimeSpent.riding << "," << vx.Rides.count << "," << tqttbtr << "," << vx.Rides.noRideAvailable << "," << vx.Rides.waitTimeTooLong << "," << vx.Rides.rideShutdown << "," << vx.Rides.eateryQueueTooLong << "," << vx.Rides.shortestQueue << "," << vx.Rides.longestQueue << "," << vx.Rides.fastPassRides << "\n";
+							}
+							else
+							{
+								chunk << g << "," << GVisitorController->Groups[g].Configuration.GetTypeToInt() << L"," << GVisitorController->GetVisitorFullName(vx) << L"," << vx.Configuration.MoneySpent << "," << vx.Configuration.GetTypeAsInt() << "," << vx.Rides.distanceTravelled << "," << dtbrc << "," << vx.TimeSpent.queuing << "," << vx.TimeSpent.travelling << "," << vx.TimeSpent.riding << "," << vx.Rides.count << "," << tqttbtr << "," << vx.Rides.noRideAvailable << "," << vx.Rides.waitTimeTooLong << "," << vx.Rides.rideShutdown << "," << vx.Rides.shortestQueue << "," << vx.Rides.longestQueue << "," << vx.Rides.fastPassRides << "\n";
+							}
+						}
 					}
-				}
-			}
+				});
 
-			file.close();
+			file.Close();
 		}
 		else
 		{
@@ -109,7 +119,7 @@ namespace ReportCSV
 	// number of rides completed vs number of visitors
 	void ReportCSV::SaveRideCount(const std::wstring file_name)
 	{
-		std::wofstream file(file_name);
+		ReportWriter file(file_name);
 
 		if (file)
 		{
@@ -120,7 +130,7 @@ namespace ReportCSV
 				file << v << "," << GVisitorController->DailyStats.rideCount[v] << "\n";
 			}
 
-			file.close();
+			file.Close();
 		}
 		else
 		{
@@ -131,36 +141,40 @@ namespace ReportCSV
 
 	void ReportCSV::SaveMinuteByMinuteLog(const std::wstring file_name)
 	{
-		std::wofstream file(file_name);
+		ReportWriter file(file_name);
 
 		if (file)
 		{
 			OutputStatus(L"Saving Minute-by-Minute report...");
 
-			std::wstring output = L"minute #";
+			file << "minute #";
 
 			// == header ==========================================================================================
 			for (int r = 0; r < GParkController->Rides.size(); r++)
 			{
-				output += L"," + GParkController->Rides[r].RideOperation.name + L" (Queue Size)," + GParkController->Rides[r].RideOperation.name + L" (Riders)," + GParkController->Rides[r].RideOperation.name + L" (Wait time)";
+				file << ',' << GParkController->Rides[r].RideOperation.name << " (Queue Size)," << GParkController->Rides[r].RideOperation.name << " (Riders)," << GParkController->Rides[r].RideOperation.name << " (Wait time)";
 			}
 
-			file << output << L",In Park,On Way,At Entrance,Idle,Riding,Queing,Queing FastPass,Travelling,Waiting,Exited,Average Rides,Min Rides,Max Rides" << "\n";
+			file << ",In Park,On Way,At Entrance,Idle,Riding,Queing,Queing FastPass,Travelling,Waiting,Exited,Average Rides,Min Rides,Max Rides" << "\n";
 
 			// == body ============================================================================================
 			for (int m = 0; m < GParkController->Rides[0].GetMinuteStatsCount(); m++)
 			{
-				output = std::to_wstring(m);
+				file << m;
 
 				for (int r = 0; r < GParkController->Rides.size(); r++)
 				{
-					output += L"," + GParkController->Rides[r].GetMinuteStatFor(m);
+					const MinuteData& rmd = GParkController->Rides[r].GetMinuteStatStructFor(m);
+
+					file << ',' << rmd.queueSize << ',' << rmd.riders << ',' << rmd.waitTimeMinutes;
 				}
 
-				file << output << L"," << GVisitorController->GetMinuteDataFor(m) << "\n";
+				const MinuteDataV& mdv = GVisitorController->GetMinuteDataStructFor(m);
+
+				file << ',' << mdv.visitorsInPark << ',' << mdv.onWay << ',' << mdv.atEntrance << ',' << mdv.idle << ',' << mdv.riding << ',' << mdv.queuing << ',' << mdv.queuingFastPass << ',' << mdv.travelling << ',' << mdv.waiting << ',' << mdv.exited << ',' << mdv.averageRides << ',' << mdv.minRides << ',' << mdv.maxRides << '\n';
 			}
 
-			file.close();
+			file.Close();
 		}
 		else
 		{
@@ -171,27 +185,25 @@ namespace ReportCSV
 
 	void ReportCSV::SaveSelectionChoiceCache(const std::wstring file_name)
 	{
-		std::wofstream file(file_name);
+		ReportWriter file(file_name);
 
 		if (file)
 		{
 			OutputStatus(L"Saving Selection Choice Cache report...");
 
-			std::wstring output = L"";
-
 			for (int t = 0; t < Constants::AvailableVisitorTypes; t++)
 			{
-				output = std::to_wstring(t);
+				file << t;
 
 				for (int i = 0; i < kSelectionChoiceCacheCount; i++)
 				{
-					output += L"," + std::to_wstring(GParkController->SelectionChoiceCache[t][i]);
+					file << ',' << GParkController->SelectionChoiceCache[t][i];
 				}
 
-				file << output << "\n";
+				file << '\n';
 			}
 
-			file.close();
+			file.Close();
 		}
 		else
 		{
@@ -203,25 +215,35 @@ namespace ReportCSV
 	// be warned! the output file will be around 280MB per 20000 visitors!
 	void ReportCSV::SaveVisitorLocation(const std::wstring file_name)
 	{
-		std::wofstream file(file_name);
+		ReportWriter file(file_name);
 
 		if (file)
 		{
 			OutputStatus(L"Saving Visitor Location report...");
 
-			std::wstring output = L"";
+			// one row per group per minute, minute-major
+			size_t group_count = GVisitorController->Groups.size();
+			size_t row_count = 0;
 
-			for (int m = 0; m < GParkController->GetMinuteCount(); m++)
+			if (GParkController->GetMinuteCount() > 0)
 			{
-				for (int g = 0; g < GVisitorController->Groups.size(); g++)
+				row_count = GParkController->GetMinuteCount() * group_count;
+			}
+
+			file.WriteChunked(row_count, kVisitorLocationRowsPerChunk, [group_count](ReportWriter& chunk, size_t first, size_t last)
 				{
-					output = GVisitorController->Groups[g].GetLocationByMinute(m);
+					for (size_t row = first; row < last; row++)
+					{
+						size_t m = row / group_count;
+						size_t g = row % group_count;
 
-					file << g << output << "\n";
-				}
-			}
+						const GroupMinuteDataVI& gmd = GVisitorController->Groups[g].Statistics.minuteLog[m];
 
-			file.close();
+						chunk << g << ',' << m << ',' << gmd.position.x << ',' << gmd.position.y << ',' << gmd.parkStatusInt << '\n';
+					}
+				});
+
+			file.Close();
 		}
 		else
 		{
@@ -233,35 +255,51 @@ namespace ReportCSV
 	// saves a complete list of visitors and each ride ridden
 	void ReportCSV::SaveVisitorRideList(const std::wstring file_name)
 	{
-		std::wofstream file(file_name);
+		ReportWriter file(file_name);
 
 		if (file)
 		{
 			OutputStatus(L"Saving Visitor Ride List report...");
 
-			std::wstring output = L"";
+			bool encode = GConfiguration->CSVReports.EncodeNames;
+
+			if (encode)
+			{
+				file << kEncodedNamesHeader << GParkController->Rides.size() << '\n';
 
-			file << L"Group ID,Visitor ID,Ride Count,Ride List" << "\n";
+				for (int r = 0; r < GParkController->Rides.size(); r++)
+				{
+					file << GParkController->Rides[r].RideOperation.name << '\n';
+				}
+			}
+
+			file << "Group ID,Visitor ID,Ride Count,Ride List" << "\n";
 
 			for (int g = 0; g < GVisitorController->Groups.size(); g++)
 			{
 				for (int v = 0; v < GVisitorController->Groups[g].Visitors.size(); v++)
 				{
-					output = L"," + std::to_wstring(GVisitorController->Groups[g].Visitors[v].RideList.size());
+					const std::vector<uint16_t>& ride_list = GVisitorController->Groups[g].Visitors[v].RideList;
+
+					file << g << ',' << v << ',' << ride_list.size();
 
-					if (GVisitorController->Groups[g].Visitors[v].RideList.size() != 0)
+					for (int r = 0; r < ride_list.size(); r++)
 					{
-						for (int r = 0; r < GVisitorController->Groups[g].Visitors[v].RideList.size(); r++)
+						if (encode)
 						{
-							output += L"," + GParkController->Rides[GVisitorController->Groups[g].Visitors[v].RideList[r]].RideOperation.name;
+							file << ',' << ride_list[r];
+						}
+						else
+						{
+							file << ',' << GParkController->Rides[ride_list[r]].RideOperation.name;
 						}
 					}
 
-					file << g << L"," << v << output << "\n";
+					file << '\n';
 				}
 			}
 
-			file.close();
+			file.Close();
 		}
 		else
 		{
@@ -271,33 +309,48 @@ namespace ReportCSV
 
 	void SaveEateryList(const std::wstring file_name)
 	{
-		std::wofstream file(file_name);
+		ReportWriter file(file_name);
 
 		if (file)
 		{
 			OutputStatus(L"Saving Eatery List report...");
 
-			std::wstring output = L"";
+			bool encode = GConfiguration->CSVReports.EncodeNames;
 
-			file << L"Group ID,Eatery Count,Eatery List" << "\n";
+			if (encode)
+			{
+				file << kEncodedNamesHeader << GParkController->Eateries.size() << '\n';
+
+				for (int e = 0; e < GParkController->Eateries.size(); e++)
+				{
+					file << GParkController->Eateries[e].Name << '\n';
+				}
+			}
+
+			file << "Group ID,Eatery Count,Eatery List" << "\n";
 
 			for (int g = 0; g < GVisitorController->Groups.size(); g++)
 			{
-				output = L"," + std::to_wstring(GVisitorController->Groups[g].EateryList.size());
+				const std::vector<int>& eatery_list = GVisitorController->Groups[g].EateryList;
+
+				file << g << ",," << eatery_list.size();
 
-				if (GVisitorController->Groups[g].EateryList.size() != 0)
+				for (int r = 0; r < eatery_list.size(); r++)
 				{
-					for (int r = 0; r < GVisitorController->Groups[g].EateryList.size(); r++)
+					if (encode)
+					{
+						file << ',' << eatery_list[r];
+					}
+					else
 					{
-						output += L"," + GParkController->Eateries[GVisitorController->Groups[g].EateryList[r]].Name;
+						file << ',' << GParkController->Eateries[eatery_list[r]].Name;
 					}
 				}
 
-				file << g << L"," << output << "\n";
-
+				file << '\n';
 			}
 
-			file.close();
+			file.Close();
 		}
 		else
 		{
@@ -306,11 +359,167 @@ namespace ReportCSV
 	}
 
 
-	void ReportCSV::OutputStatus(const std::wstring status)
+	// reads a list written with /encodenames: a "#names,n" line, n names (one per line, index order),
+	// the usual column header, then one row per visitor (or group) of two id columns, the item count and
+	// the item indices. a plain (unencoded) list is rejected
+	bool LoadEncodedList(const std::wstring file_name, EncodedList& list)
+	{
+		std::ifstream file(std::filesystem::path(file_name), std::ios::binary);
+
+		if (!file)
+		{
+			std::wcerr << L"Unable to open \"" << file_name << L"\"." << std::endl;
+
+			return false;
+		}
+
+		std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+		std::string_view text(data);
+
+		size_t position = 0;
+
+		auto next_line = [&text, &position]()
+			{
+				size_t end = text.find('\n', position);
+
+				if (end == std::string_view::npos)
+				{
+					end = text.size();
+				}
+
+				std::string_view line = text.substr(position, end - position);
+
+				position = end + 1;
+
+				if (line.size() != 0 && line.back() == '\r')
+				{
+					line.remove_suffix(1);
+				}
+
+				return line;
+			};
+
+		std::string_view line = next_line();
+
+		size_t name_count = 0;
+
+		if (line.compare(0, kEncodedNamesHeader.size(), kEncodedNamesHeader) != 0 ||
+			std::from_chars(line.data() + kEncodedNamesHeader.size(), line.data() + line.size(), name_count).ec != std::errc())
+		{
+			std::wcerr << L"\"" << file_name << L"\" is not an encoded list (expected a \"" << kEncodedNamesHeader.c_str() << L"\" line)." << std::endl;
+
+			return false;
+		}
+
+		for (size_t n = 0; n < name_count && position < text.size(); n++)
+		{
+			list.Names.push_back(std::string(next_line()));
+		}
+
+		list.Header = std::string(next_line());
+
+		while (position < text.size())
+		{
+			line = next_line();
+
+			if (line.size() == 0)
+			{
+				continue;
+			}
+
+			size_t first_comma = line.find(',');
+			size_t second_comma = (first_comma == std::string_view::npos) ? first_comma : line.find(',', first_comma + 1);
+
+			if (second_comma == std::string_view::npos)
+			{
+				std::wcerr << L"Malformed row in \"" << file_name << L"\"." << std::endl;
+
+				return false;
+			}
+
+			list.Keys.push_back(std::string(line.substr(0, second_comma)));
+
+			std::vector<int> items;
+
+			const char* current = line.data() + second_comma + 1;
+			const char* end = line.data() + line.size();
+
+			int count = 0;
+
+			current = std::from_chars(current, end, count).ptr;
+
+			while (current < end && *current == ',')
+			{
+				int item = 0;
+
+				std::from_chars_result result = std::from_chars(current + 1, end, item);
+
+				if (result.ec != std::errc() || item < 0 || item >= list.Names.size())
+				{
+					std::wcerr << L"Invalid name index in \"" << file_name << L"\"." << std::endl;
+
+					return false;
+				}
+
+				items.push_back(item);
+
+				current = result.ptr;
+			}
+
+			list.Items.push_back(std::move(items));
+		}
+
+		return true;
+	}
+
+
+	// writes the plain (name per item) version of an encoded list to "<file>_expanded.csv"
+	bool ExpandEncodedList(const std::wstring file_name)
 	{
-		if (!GConfiguration->DebugConfig.DisableConsoleOutput)
+		EncodedList list;
+
+		if (!LoadEncodedList(file_name, list))
 		{
-			std::wcout << status << std::endl;
+			return false;
 		}
+
+		std::wstring output_name = std::filesystem::path(file_name).replace_extension().wstring() + L"_expanded.csv";
+
+		ReportWriter file(output_name);
+
+		if (file)
+		{
+			OutputStatus(L"Expanding \"" + file_name + L"\" to \"" + output_name + L"\"...");
+
+			file << list.Header << '\n';
+
+			for (int r = 0; r < list.Keys.size(); r++)
+			{
+				file << list.Keys[r] << ',' << list.Items[r].size();
+
+				for (int i = 0; i < list.Items[r].size(); i++)
+				{
+					file << ',' << list.Names[list.Items[r][i]];
+				}
+
+				file << '\n';
+			}
+
+			file.Close();
+
+			return true;
+		}
+
+		std::wcerr << L"Unable to save \"" << output_name << L"\"." << std::endl;
+
+		return false;
+	}
+
+
+	// reports may be generated concurrently, so status goes through the (locked) report controller
+	void ReportCSV::OutputStatus(const std::wstring status)
+	{
+		GReportController->OutputStatus(status);
 	}
 }
\ No newline at end of file
@@ -14,6 +14,24 @@
 
 
 #include <fstream>
+#include <string>
+#include <vector>
+
+
+static const size_t kVisitorDataGroupsPerChunk = 4096;		// rows are formatted in parallel in chunks of this many groups
+static const size_t kVisitorLocationRowsPerChunk = 65536;	// ~2MB of output per chunk
+
+static const std::string kEncodedNamesHeader = "#names,";	// first line of a list written with /encodenames
+
+
+// a ride or eatery list written with /encodenames
+struct EncodedList {
+	std::vector<std::string> Names;				// UTF-8, in index order
+	std::string Header;							// the csv column header
+
+	std::vector<std::string> Keys;				// id columns of each row, e.g. "12,3"
+	std::vector<std::vector<int>> Items;		// name indices of each row
+};
 
 
 namespace ReportCSV
@@ -32,5 +50,8 @@ namespace ReportCSV
 	void SaveVisitorRideList(const std::wstring);
 	void SaveEateryList(const std::wstring);
 
+	bool LoadEncodedList(const std::wstring, EncodedList&);
+	bool ExpandEncodedList(const std::wstring);
+
 	void OutputStatus(const std::wstring);
 }
\ No newline at end of file
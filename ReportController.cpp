@@ -10,18 +10,27 @@
 // =======================================================================
 
 
+#include <atomic>
+#include <chrono>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <thread>
 
+#include "Configuration.h"
 #include "ParkController.h"
+#include "Profiler.h"
 #include "ReportController.h"
 #include "ReportCSV.h"
 #include "ReportHTML.h"
+#include "ReportHTMLCompact.h"
 #include "ReportText.h"
 #include "Utility.h"
 #include "VisitorController.h"
 
 
+extern Configuration* GConfiguration;
 extern ParkController* GParkController;
 extern VisitorController* GVisitorController;
 
@@ -35,10 +44,13 @@ ReportController::ReportController(bool show_output)
 }
 
 
+// safe to call from any report thread
 void ReportController::OutputStatus(const std::wstring status)
 {
 	if (ShowOutput)
 	{
+		std::lock_guard<std::mutex> lock(OutputLock);
+
 		std::wcout << status << std::endl;
 	}
 }
@@ -48,6 +60,81 @@ void ReportController::OutputStatus(const std::wstring status)
 // =======================================================================================================================
 
 
+void ReportController::AddTask(const std::wstring name, std::function<void()> run)
+{
+	Tasks.push_back({ name, run });
+}
+
+
+// runs every queued report on a pool of worker threads, returning once they have all finished
+void ReportController::RunTasks()
+{
+	if (Tasks.size() == 0)
+	{
+		return;
+	}
+
+	size_t thread_count = std::thread::hardware_concurrency();
+
+	if (thread_count == 0)
+	{
+		thread_count = 1;
+	}
+
+	if (thread_count > Tasks.size())
+	{
+		thread_count = Tasks.size();
+	}
+
+	OutputStatus(L"Generating " + std::to_wstring(Tasks.size()) + L" report(s) on " + std::to_wstring(thread_count) + L" thread(s)...");
+
+	std::atomic<size_t> next_task = 0;
+	std::atomic<size_t> completed = 0;
+
+	auto worker = [&]()
+	{
+		size_t t;
+
+		while ((t = next_task++) < Tasks.size())
+		{
+			auto start = std::chrono::steady_clock::now();
+
+			Tasks[t].run();
+
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+			GProfiler->AddReport(Tasks[t].name, elapsed.count());
+
+			size_t done = ++completed;
+
+			std::wostringstream progress;
+
+			progress << L"  [" << done << L"/" << Tasks.size() << L"] " << Tasks[t].name << L" (" << std::fixed << std::setprecision(2) << elapsed.count() << L"s)";
+
+			OutputStatus(progress.str());
+		}
+	};
+
+	std::vector<std::thread> workers;
+
+	for (size_t i = 0; i < thread_count; i++)
+	{
+		workers.emplace_back(worker);
+	}
+
+	for (size_t i = 0; i < workers.size(); i++)
+	{
+		workers[i].join();
+	}
+
+	Tasks.clear();
+}
+
+
+// =======================================================================================================================
+// =======================================================================================================================
+
+
 void ReportController::SaveRideDataCSV(const std::wstring file_name)
 {
 	ReportCSV::SaveRideData(file_name);
@@ -90,13 +177,30 @@ void ReportController::SaveVisitorRideListCSV(const std::wstring file_name)
 }
 
 
+bool ReportController::ExpandEncodedListCSV(const std::wstring file_name)
+{
+	return ReportCSV::ExpandEncodedList(file_name);
+}
+
+
 // =======================================================================================================================
 // =======================================================================================================================
 
 
 void ReportController::SaveSimulationReportHTML(const std::wstring file_name, FastPassType fastpass_mode)
 {
-	if (!ReportHTML::SaveSimulationReport(file_name, fastpass_mode))
+	bool saved = false;
+
+	if (GConfiguration->HTMLReports.Compact)
+	{
+		saved = ReportHTMLCompact::SaveSimulationReport(file_name, fastpass_mode);
+	}
+	else
+	{
+		saved = ReportHTML::SaveSimulationReport(file_name, fastpass_mode);
+	}
+
+	if (!saved)
 	{
 		std::cerr << "Unable to save HTML Simulation report." << std::endl;
 	}
@@ -13,19 +13,43 @@
 #pragma once
 
 
+#include <functional>
+#include <mutex>
 #include <string>
+#include <vector>
+
+#include "QWaitTypes.h"
+
+
+// a report that can be generated independently of the others; reports only read finished simulation state
+struct ReportTask {
+	std::wstring name = L"";
+
+	std::function<void()> run;
+};
 
 
 class ReportController
 {
 	bool ShowOutput = true;
 
-	void OutputStatus(const std::wstring);
+	std::mutex OutputLock;
+
+	std::vector<ReportTask> Tasks;
 
 public:
 
 	ReportController(bool);
 
+	void OutputStatus(const std::wstring);
+
+	// =======================================================================
+	// == Background generation ==============================================
+	// =======================================================================
+
+	void AddTask(const std::wstring, std::function<void()>);
+	void RunTasks();
+
 	// =======================================================================
     // == CSV Reports =======================================================
     // =======================================================================
@@ -42,6 +66,8 @@ public:
 
 	void SaveVisitorRideListCSV(const std::wstring);
 
+	bool ExpandEncodedListCSV(const std::wstring);
+
 	// =======================================================================
 	// == HTML Reports =======================================================
 	// =======================================================================
@@ -18,6 +18,7 @@
 #include "Configuration.h"
 #include "ParkController.h"
 #include "ReportHTML.h"
+#include "Utility.h"
 #include "VisitorController.h"
 
 
@@ -491,11 +492,11 @@ namespace ReportHTML
 
 				if (GConfiguration->FastPassMode == FastPassType::None)
 				{
-					MxMTableRow(file, m, mdv.time, mdv.visitorsInPark, mdv.idle, mdv.travelling, mdv.queuing, mdv.riding, mdv.waiting);
+					MxMTableRow(file, m, Utility::FormatTime(mdv.time), mdv.visitorsInPark, mdv.idle, mdv.travelling, mdv.queuing, mdv.riding, mdv.waiting);
 				}
 				else
 				{
-					MxMTableRow(file, m, mdv.time, mdv.visitorsInPark, mdv.idle, mdv.travelling, mdv.queuing, mdv.queuingFastPass, mdv.riding, mdv.waiting);
+					MxMTableRow(file, m, Utility::FormatTime(mdv.time), mdv.visitorsInPark, mdv.idle, mdv.travelling, mdv.queuing, mdv.queuingFastPass, mdv.riding, mdv.waiting);
 				}
 			}
 
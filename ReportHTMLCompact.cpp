@@ -0,0 +1,626 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "Configuration.h"
+#include "ParkController.h"
+#include "ReportHTMLCompact.h"
+#include "ReportWriter.h"
+#include "Utility.h"
+#include "VisitorController.h"
+
+
+extern Configuration* GConfiguration;
+extern ParkController* GParkController;
+extern VisitorController* GVisitorController;
+
+
+namespace
+{
+	// each table is { "t": title, "h": [column names], "g": graph column, "m": graph scale (0 = largest value), "r": [rows], "a": average row }
+	// row[0] is the name, the remaining entries are numbers. bars are drawn in the final column from row[g] / scale
+	static const char* kPageHead =
+		"<!DOCTYPE html><html><head><meta charset=\"utf-8\"><title>QWait</title>\n"
+		"<style>\n"
+		"body{font-family:Geneva,Arial,Helvetica,sans-serif;font-size:10pt}\n"
+		"table{width:1211px;margin:0 auto 16px auto;border-spacing:1px}\n"
+		"td{height:13px;padding:1px}td.n{text-align:right;width:80px}\n"
+		"tr:nth-child(even){background:#EEEEEE}tr:nth-child(odd){background:#DDDDDD}tr.h{background:#88DDFF;font-weight:bold}tr.a{background:#EEEEFF}\n"
+		"div.b{height:8px}\n"
+		"svg{display:block;margin:0 auto 16px auto;background:#EEEEEE}\n"
+		"</style></head><body>\n"
+		"<div id=\"r\"></div>\n"
+		"<script>\n"
+		"var D=";
+
+	static const char* kPageScript =
+		";\n"
+		"function e(s){return String(s).replace(/&/g,'&amp;').replace(/</g,'&lt;');}\n"
+		"function f(v){return typeof v=='number'&&v%1!=0?v.toFixed(2):e(v);}\n"
+		"function bar(pc,w,avg){if(!(pc>=0.01))return '';if(pc>100)pc=100;var c=avg?'#FF0000':pc<75?'#00BB22':pc<90?'#BBBB22':'#FF0000';"
+		"return '<div class=\"b\" style=\"width:'+Math.floor(pc*w/100)+'px;background:'+c+'\"></div>';}\n"
+		"function table(t){var h='<table><tr class=\"h\"><td colspan=\"'+(t.h.length+1)+'\" style=\"font-size:1.5em\">'+e(t.t)+'</td></tr><tr class=\"h\">';"
+		"t.h.forEach(function(c,i){h+='<td'+(i?' class=\"n\"':'')+'>'+e(c)+'</td>';});h+='<td></td></tr>';"
+		"var m=t.m;if(!m){t.r.forEach(function(r){if(r[t.g]>m)m=r[t.g];});}"
+		"function row(r,cls){h+='<tr'+cls+'>';r.forEach(function(v,i){h+='<td'+(i?' class=\"n\"':'')+'>'+f(v)+'</td>';});"
+		"h+='<td style=\"width:'+(1100-80*r.length)+'px\">'+bar(m?r[t.g]/m*100:0,1080-80*r.length,cls!='')+'</td></tr>';}\n"
+		"t.r.forEach(function(r){row(r,'');});if(t.a)row(t.a,' class=\"a\"');return h+'</table>';}\n"
+		"function chart(c){var w=1211,ht=260,p=30,top=0,h='';c.s.forEach(function(s){s.y.forEach(function(v){if(v>top)top=v;});});if(!top)top=1;"
+		"var col=['#000000','#00BB22','#2266FF','#FF8800','#FF0000','#AA00AA','#00AAAA','#888800'];"
+		"h+='<svg width=\"'+w+'\" height=\"'+(ht+2*p)+'\">';"
+		"c.l.forEach(function(l){var x=p+l[0]/(c.n-1)*(w-2*p);h+='<line x1=\"'+x+'\" y1=\"'+p+'\" x2=\"'+x+'\" y2=\"'+(ht+p)+'\" stroke=\"#CCCCCC\"/><text x=\"'+x+'\" y=\"'+(ht+p+16)+'\" font-size=\"10\" text-anchor=\"middle\">'+e(l[1])+'</text>';});"
+		"c.s.forEach(function(s,i){var pts=s.x.map(function(x,j){return (p+x/(c.n-1)*(w-2*p)).toFixed(1)+','+(p+ht-s.y[j]/top*ht).toFixed(1);}).join(' ');"
+		"h+='<polyline fill=\"none\" stroke-width=\"1.5\" stroke=\"'+col[i%col.length]+'\" points=\"'+pts+'\"/>';"
+		"h+='<text x=\"'+(p+i*110)+'\" y=\"18\" font-size=\"11\" fill=\"'+col[i%col.length]+'\">'+e(s.n)+'</text>';});"
+		"h+='<text x=\"'+(w-p)+'\" y=\"18\" font-size=\"10\" text-anchor=\"end\">max '+top+'</text>';return h+'</svg>';}\n"
+		"var h='<table><tr class=\"h\"><td colspan=\"2\" style=\"font-size:2em\">&quot;'+e(D.park)+'&quot; Summary</td></tr>';"
+		"D.summary.forEach(function(s){h+='<tr><td style=\"width:400px\">'+e(s[0])+'</td><td><b>'+f(s[1])+'</b></td></tr>';});h+='</table>';\n"
+		"D.tables.forEach(function(t){h+=table(t);});\n"
+		"if(D.mxm){h+='<table><tr class=\"h\"><td style=\"font-size:1.5em\">Minute by minute</td></tr></table>'+chart(D.mxm);}\n"
+		"h+='<table><tr class=\"h\"><td style=\"text-align:right\">QWait</td></tr></table>';\n"
+		"document.getElementById('r').innerHTML=h;\n"
+		"</script></body></html>\n";
+
+
+	void TableStart(ReportWriter& file, bool first, const std::wstring title, std::vector<std::wstring> columns, int graph_column, double scale)
+	{
+		if (!first)
+		{
+			file << ",\n";
+		}
+
+		file << "{\"t\":";
+		ReportHTMLCompact::String(file, title);
+		file << ",\"h\":[";
+
+		for (int c = 0; c < columns.size(); c++)
+		{
+			if (c != 0)
+			{
+				file << ',';
+			}
+
+			ReportHTMLCompact::String(file, columns[c]);
+		}
+
+		file << "],\"g\":" << graph_column << ",\"m\":";
+		ReportHTMLCompact::Number(file, scale);
+		file << ",\"r\":[";
+	}
+
+
+	void TableRow(ReportWriter& file, bool first, const std::wstring name, std::vector<double> values)
+	{
+		if (!first)
+		{
+			file << ',';
+		}
+
+		file << '[';
+		ReportHTMLCompact::String(file, name);
+
+		for (int v = 0; v < values.size(); v++)
+		{
+			file << ',';
+			ReportHTMLCompact::Number(file, values[v]);
+		}
+
+		file << ']';
+	}
+
+
+	void TableEnd(ReportWriter& file)
+	{
+		file << "],\"a\":null}";
+	}
+
+
+	void TableEnd(ReportWriter& file, std::vector<double> average)
+	{
+		file << "],\"a\":";
+		TableRow(file, true, L"Average", average);
+		file << '}';
+	}
+
+
+	void SummaryRow(ReportWriter& file, const std::wstring label, double value)
+	{
+		file << '[';
+		ReportHTMLCompact::String(file, label);
+		file << ',';
+		ReportHTMLCompact::Number(file, value);
+		file << "],";
+	}
+}
+
+
+namespace ReportHTMLCompact
+{
+	bool SaveSimulationReport(const std::wstring file_name, FastPassType fast_pass_mode)
+	{
+		ReportWriter file(file_name);
+
+		if (file)
+		{
+			file << kPageHead;
+
+			file << "{\"park\":";
+			String(file, GParkController->entrance.ParkName);
+			file << ",\n";
+
+			Summary(file);
+
+			file << "\"tables\":[\n";
+
+			TicketList(file);
+			RideList(file);
+
+			if (GConfiguration->HandleFoodDrink)
+			{
+				EateryList(file);
+			}
+
+			if (GVisitorController->GroupCountCreated != 0)
+			{
+				std::vector<std::wstring> group_names(Constants::GroupNames, Constants::GroupNames + Constants::AvailableGroupTypes);
+				std::vector<std::wstring> type_names;
+
+				for (int t = 0; t < Constants::AvailableVisitorTypes; t++)
+				{
+					type_names.push_back(QWaitTypes::VisitorTypeToString(t));
+				}
+
+				DailyStatsList(file, L"Group Description", group_names, GVisitorController->DailyStatsByGroup);
+				VisitorRideList(file);
+				DailyStatsList(file, L"Type Description", type_names, GVisitorController->DailyStatsByType);
+			}
+
+			file << "],\n";
+
+			MinuteByMinute(file, fast_pass_mode);
+
+			file << "}";
+
+			file << kPageScript;
+
+			file.Close();
+
+			return true;
+		}
+
+		return false;
+	}
+
+
+	// picks threshold points from the series that best preserve its visual shape (Steinarsson, 2013).
+	// the first and last points are always kept; every other bucket keeps the point forming the
+	// largest triangle with the previously kept point and the average of the next bucket
+	std::vector<int> LargestTriangleThreeBuckets(const std::vector<int>& values, int threshold)
+	{
+		std::vector<int> indices;
+
+		int count = static_cast<int>(values.size());
+
+		if (threshold >= count || threshold < 3)
+		{
+			for (int i = 0; i < count; i++)
+			{
+				indices.push_back(i);
+			}
+
+			return indices;
+		}
+
+		indices.reserve(threshold);
+
+		double bucket_size = (double)(count - 2) / (double)(threshold - 2);
+
+		int previous = 0;
+
+		indices.push_back(0);
+
+		for (int b = 0; b < threshold - 2; b++)
+		{
+			int range_start = static_cast<int>(b * bucket_size) + 1;
+			int range_end = static_cast<int>((b + 1) * bucket_size) + 1;
+
+			int next_start = range_end;
+			int next_end = static_cast<int>((b + 2) * bucket_size) + 1;
+
+			if (next_end > count)
+			{
+				next_end = count;
+			}
+
+			double average_x = 0;
+			double average_y = 0;
+
+			for (int i = next_start; i < next_end; i++)
+			{
+				average_x += i;
+				average_y += values[i];
+			}
+
+			if (next_end > next_start)
+			{
+				average_x /= (next_end - next_start);
+				average_y /= (next_end - next_start);
+			}
+			else
+			{
+				average_x = count - 1;
+				average_y = values[count - 1];
+			}
+
+			double largest_area = -1;
+			int chosen = range_start;
+
+			for (int i = range_start; i < range_end; i++)
+			{
+				double area = std::abs((previous - average_x) * (values[i] - values[previous]) - (previous - i) * (average_y - values[previous]));
+
+				if (area > largest_area)
+				{
+					largest_area = area;
+					chosen = i;
+				}
+			}
+
+			indices.push_back(chosen);
+
+			previous = chosen;
+		}
+
+		indices.push_back(count - 1);
+
+		return indices;
+	}
+
+
+	namespace
+	{
+		void Summary(ReportWriter& file)
+		{
+			file << "\"summary\":[";
+
+			SummaryRow(file, L"Rides", static_cast<double>(GParkController->Rides.size()));
+			SummaryRow(file, L"Theoretical throughput (riders per day)", GParkController->TheoreticalHourThroughputTotalDay);
+			SummaryRow(file, L"Actual rides", GVisitorController->DailyStats.totalRides);
+
+			if (GConfiguration->FastPassMode != FastPassType::None)
+			{
+				SummaryRow(file, L"Fastpass rides", GVisitorController->DailyStats.totalFastPastRides);
+			}
+
+			SummaryRow(file, L"Groups", GVisitorController->GroupCountCreated);
+			SummaryRow(file, L"Visitors", GVisitorController->VisitorCountCreated);
+			SummaryRow(file, L"Opening time", GConfiguration->ParkOpenTime);
+			SummaryRow(file, L"Closing time", GConfiguration->ParkCloseTime);
+
+			SummaryRow(file, L"Max rides", GVisitorController->DailyStats.maxRides);
+			SummaryRow(file, L"Minimum rides", GVisitorController->DailyStats.minRides);
+			SummaryRow(file, L"Zero rides", GVisitorController->DailyStats.zeroRides);
+			SummaryRow(file, L"Average rides", GVisitorController->DailyStats.averageRides);
+
+			SummaryRow(file, L"Distance travelled (metres)", GVisitorController->DailyStats.distanceTravelled);
+			SummaryRow(file, L"Average distance travelled (metres)", GVisitorController->DailyStats.averageDistanceTravelled);
+
+			SummaryRow(file, L"Total idle time (minutes)", GVisitorController->DailyStats.totalIdleTime);
+			SummaryRow(file, L"Total travel time (minutes)", GVisitorController->DailyStats.totalTravellingTime);
+			SummaryRow(file, L"Total queue time (minutes)", GVisitorController->DailyStats.totalQueueTime);
+			SummaryRow(file, L"Total ride time (minutes)", GVisitorController->DailyStats.totalRidingTime);
+
+			SummaryRow(file, L"Average idle time (minutes)", GVisitorController->DailyStats.averageIdleTime);
+			SummaryRow(file, L"Average travel time (minutes)", GVisitorController->DailyStats.averageTravellingTime);
+			SummaryRow(file, L"Average queue time (minutes)", GVisitorController->DailyStats.averageQueueTime);
+			SummaryRow(file, L"Average ride time (minutes)", GVisitorController->DailyStats.averageRidingTime);
+
+			SummaryRow(file, L"Total ticket spend ($)", GVisitorController->DailyStats.totalRideSpend);
+			SummaryRow(file, L"Average cost per ride ($)", GVisitorController->DailyStats.totalSpendPerRide);
+
+			if (GConfiguration->HandleFoodDrink)
+			{
+				SummaryRow(file, L"Total eatery spend ($)", GVisitorController->DailyStats.totalEaterySpend);
+				SummaryRow(file, L"Average eatery spend per visitor ($)", GVisitorController->DailyStats.averageEaterySpend);
+				SummaryRow(file, L"Total eateries visited", GVisitorController->DailyStats.totalEateriesVisited);
+				SummaryRow(file, L"Total travel food (minutes)", GVisitorController->DailyStats.totalTravellingFoodTime);
+				SummaryRow(file, L"Total queue food (minutes)", GVisitorController->DailyStats.totalQueueFoodTime);
+				SummaryRow(file, L"Total eat time (minutes)", GVisitorController->DailyStats.totalEatingTime);
+				SummaryRow(file, L"Average travel food (minutes)", GVisitorController->DailyStats.averageTravellingFoodTime);
+				SummaryRow(file, L"Average queue food (minutes)", GVisitorController->DailyStats.averageQueueFoodTime);
+				SummaryRow(file, L"Average eat time (minutes)", GVisitorController->DailyStats.averageEatingTime);
+				SummaryRow(file, L"Average eateries visited", GVisitorController->DailyStats.averageEateriesVisited);
+				SummaryRow(file, L"Average time per visit (minutes)", GVisitorController->DailyStats.averageTimePerEateryVisit);
+			}
+
+			file << '[';
+			String(file, L"Temperature ('C)");
+			file << ',';
+			Number(file, GConfiguration->Climate.Temperature);
+			file << "]],\n";
+		}
+
+
+		void TicketList(ReportWriter& file)
+		{
+			TableStart(file, true, L"Ticket purchases", { L"Ticket", L"Qty." }, 1, 0);
+
+			TableRow(file, true, L"Adult ($" + std::to_wstring(GParkController->entrance.Prices.Adult) + L")", { (double)GParkController->entrance.Tickets.Adult });
+			TableRow(file, false, L"Child ($" + std::to_wstring(GParkController->entrance.Prices.Children) + L")", { (double)GParkController->entrance.Tickets.Children });
+			TableRow(file, false, L"Baby ($" + std::to_wstring(GParkController->entrance.Prices.Babies) + L")", { (double)GParkController->entrance.Tickets.Babies });
+			TableRow(file, false, L"Adult advanced ($" + std::to_wstring(GParkController->entrance.Prices.AdultAdvance) + L")", { (double)GParkController->entrance.Tickets.AdultAdvance });
+			TableRow(file, false, L"Child advanced ($" + std::to_wstring(GParkController->entrance.Prices.ChildrenAdvance) + L")", { (double)GParkController->entrance.Tickets.ChildrenAdvance });
+			TableRow(file, false, L"Baby advanced ($" + std::to_wstring(GParkController->entrance.Prices.BabiesAdvance) + L")", { (double)GParkController->entrance.Tickets.BabiesAdvance });
+
+			TableEnd(file);
+		}
+
+
+		void RideList(ReportWriter& file)
+		{
+			if (GParkController->Rides.size() != 0)
+			{
+				TableStart(file, false, L"Ride throughput", { L"Name", L"Rides", L"Hourly Max.", L"Throughput %" }, 3, 100);
+
+				for (int r = 0; r < GParkController->Rides.size(); r++)
+				{
+					double tpc = ((double)GParkController->Rides[r].DailyStatistics.totalRiders / ((double)GParkController->Rides[r].RideThroughput.totalPerHour * (double)GParkController->Rides[r].RideOperation.operationHours)) * 100.0;
+
+					TableRow(file, r == 0, GParkController->Rides[r].RideOperation.name, { (double)GParkController->Rides[r].DailyStatistics.totalRiders, (double)GParkController->Rides[r].RideThroughput.totalPerHour, tpc });
+				}
+
+				TableEnd(file);
+
+				TableStart(file, false, L"Max. Queue (visitors)", { L"Name", L"Max. Q" }, 1, 0);
+
+				for (int r = 0; r < GParkController->Rides.size(); r++)
+				{
+					TableRow(file, r == 0, GParkController->Rides[r].RideOperation.name, { (double)GParkController->Rides[r].DailyStatistics.maxQueueLength });
+				}
+
+				TableEnd(file);
+			}
+		}
+
+
+		void EateryList(ReportWriter& file)
+		{
+			if (GParkController->Eateries.size() != 0)
+			{
+				TableStart(file, false, L"Eateries", { L"Name", L"Customers", L"Max Q.", L"Income" }, 2, 0);
+
+				for (int e = 0; e < GParkController->Eateries.size(); e++)
+				{
+					TableRow(file, e == 0, GParkController->Eateries[e].Name, { (double)GParkController->Eateries[e].Statistics.Customers, (double)GParkController->Eateries[e].Statistics.MaxQueue, (double)GParkController->Eateries[e].Statistics.Spend });
+				}
+
+				TableEnd(file);
+			}
+		}
+
+
+		// one table per statistic, shared by the group type and visitor type lists
+		void DailyStatsList(ReportWriter& file, const std::wstring description, const std::vector<std::wstring>& names, DailyStatistics* stats)
+		{
+			struct StatColumn {
+				const wchar_t* title;
+				const wchar_t* heading;
+				double (*value)(const DailyStatistics&);
+				double (*average)(const DailyStatistics&);		// from the whole park DailyStats, nullptr for none
+			};
+
+			static const StatColumn columns[] = {
+				{ L"No Ride Available", L"NRA", [](const DailyStatistics& s) { return (double)s.noRideAvailable; }, nullptr },
+				{ L"Wait Time Too Long", L"WTTL", [](const DailyStatistics& s) { return (double)s.waitTimeTooLong; }, nullptr },
+				{ L"Ride Shutdown", L"RS", [](const DailyStatistics& s) { return (double)s.rideShutdown; }, nullptr },
+				{ L"Eatery Queue Too Long", L"EQTL", [](const DailyStatistics& s) { return (double)s.eateryQueueTooLong; }, nullptr },
+				{ L"Distance Travelled (metres)", L"DT (m)", [](const DailyStatistics& s) { return (double)s.distanceTravelled; }, [](const DailyStatistics& s) { return (double)s.averageDistanceTravelled; } },
+				{ L"Average Idle Time (minutes)", L"AIT", [](const DailyStatistics& s) { return s.averageIdleTime; }, [](const DailyStatistics& s) { return s.averageIdleTime; } },
+				{ L"Average Travelling Time (minutes)", L"ATT", [](const DailyStatistics& s) { return s.averageTravellingTime; }, [](const DailyStatistics& s) { return s.averageTravellingTime; } },
+				{ L"Average Queue Time (minutes)", L"AQT", [](const DailyStatistics& s) { return (double)s.averageQueueTime; }, [](const DailyStatistics& s) { return (double)s.averageQueueTime; } },
+				{ L"Average Riding Time (minutes)", L"ART", [](const DailyStatistics& s) { return s.averageRidingTime; }, [](const DailyStatistics& s) { return s.averageRidingTime; } }
+			};
+
+			for (int c = 0; c < sizeof(columns) / sizeof(StatColumn); c++)
+			{
+				TableStart(file, false, columns[c].title, { description, columns[c].heading }, 1, 0);
+
+				for (int t = 0; t < names.size(); t++)
+				{
+					TableRow(file, t == 0, names[t], { columns[c].value(stats[t]) });
+				}
+
+				if (columns[c].average != nullptr)
+				{
+					TableEnd(file, { columns[c].average(GVisitorController->DailyStats) });
+				}
+				else
+				{
+					TableEnd(file);
+				}
+			}
+		}
+
+
+		void VisitorRideList(ReportWriter& file)
+		{
+			TableStart(file, false, L"Visitors by ride count", { L"Ride count", L"# Visitors", L"% of total" }, 1, 0);
+
+			int most_rides_index = GVisitorController->GetLargestValueByType(kDailyStatsHighestRideCountByIndex);
+
+			for (int t = 0; t <= most_rides_index; t++)
+			{
+				double pc_value = ((double)GVisitorController->DailyStats.rideCount[t] / (double)GVisitorController->VisitorCountCreated) * 100.0;
+
+				TableRow(file, t == 0, std::to_wstring(t), { (double)GVisitorController->DailyStats.rideCount[t], pc_value });
+			}
+
+			TableEnd(file, { (double)GVisitorController->DailyStats.averageRides, 0 });
+		}
+
+
+		// series are downsampled independently, each keeps its own x (minute) values
+		void MinuteByMinute(ReportWriter& file, FastPassType fast_pass_mode)
+		{
+			if (GParkController->Rides.size() == 0 || GParkController->Rides[0].GetMinuteStatsCount() == 0)
+			{
+				file << "\"mxm\":null";
+
+				return;
+			}
+
+			int minutes = static_cast<int>(GParkController->Rides[0].GetMinuteStatsCount());
+
+			std::vector<int> in_park(minutes), idle(minutes), travelling(minutes), queuing(minutes), queuing_fastpass(minutes), riding(minutes), busy(minutes);
+
+			file << "\"mxm\":{\"n\":" << minutes << ",\"l\":[";
+
+			for (int m = 0; m < minutes; m++)
+			{
+				const MinuteDataV& mdv = GVisitorController->GetMinuteDataStructFor(m);
+
+				in_park[m] = mdv.visitorsInPark;
+				idle[m] = mdv.idle;
+				travelling[m] = mdv.travelling;
+				queuing[m] = mdv.queuing;
+				queuing_fastpass[m] = mdv.queuingFastPass;
+				riding[m] = mdv.riding;
+				busy[m] = mdv.waiting;
+
+				if (m % 60 == 0)
+				{
+					if (m != 0)
+					{
+						file << ',';
+					}
+
+					file << '[' << m << ',';
+					String(file, Utility::FormatTime(mdv.time));
+					file << ']';
+				}
+			}
+
+			file << "],\"s\":[";
+
+			Series(file, L"In Park", in_park);
+			file << ',';
+			Series(file, L"Idle", idle);
+			file << ',';
+			Series(file, L"Travel", travelling);
+			file << ',';
+			Series(file, L"Queue", queuing);
+			file << ',';
+
+			if (fast_pass_mode != FastPassType::None)
+			{
+				Series(file, L"Queue FP", queuing_fastpass);
+				file << ',';
+			}
+
+			Series(file, L"Ride", riding);
+			file << ',';
+			Series(file, L"Busy", busy);
+
+			file << "]}";
+		}
+
+
+		void Series(ReportWriter& file, const std::wstring name, const std::vector<int>& values)
+		{
+			std::vector<int> indices = LargestTriangleThreeBuckets(values, kHTMLChartPoints);
+
+			file << "{\"n\":";
+			String(file, name);
+			file << ",\"x\":[";
+
+			for (int i = 0; i < indices.size(); i++)
+			{
+				if (i != 0)
+				{
+					file << ',';
+				}
+
+				file << indices[i];
+			}
+
+			file << "],\"y\":[";
+
+			for (int i = 0; i < indices.size(); i++)
+			{
+				if (i != 0)
+				{
+					file << ',';
+				}
+
+				file << values[indices[i]];
+			}
+
+			file << "]}";
+		}
+
+
+		// JSON string; '<' is escaped too so that names can't close the script element
+		void String(ReportWriter& file, const std::wstring& text)
+		{
+			file << '"';
+
+			size_t start = 0;
+
+			for (size_t i = 0; i < text.size(); i++)
+			{
+				wchar_t c = text[i];
+
+				if (c == L'"' || c == L'\\' || c == L'<' || c < 0x20)
+				{
+					file << text.substr(start, i - start);
+
+					switch (c)
+					{
+					case L'"':
+						file << "\\\"";
+						break;
+					case L'\\':
+						file << "\\\\";
+						break;
+					case L'<':
+						file << "\\u003c";
+						break;
+					default:
+						file << ' ';
+						break;
+					}
+
+					start = i + 1;
+				}
+			}
+
+			file << text.substr(start) << '"';
+		}
+
+
+		// JSON has no representation for NaN or infinity (e.g. from averages over empty categories)
+		void Number(ReportWriter& file, double value)
+		{
+			if (std::isfinite(value))
+			{
+				file << value;
+			}
+			else
+			{
+				file << '0';
+			}
+		}
+	}
+}
\ No newline at end of file
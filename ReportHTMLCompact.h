@@ -0,0 +1,52 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+#include <string>
+#include <vector>
+
+#include "QWaitTypes.h"
+#include "ReportWriter.h"
+#include "VisitorController.h"
+
+
+static const int kHTMLChartPoints = 360;		// minute-by-minute series are downsampled to this many points
+
+
+// writes the simulation report as a small static page plus the report data as one embedded JSON object;
+// the tables and charts are built by the browser. the minute-by-minute section is drawn as charts of
+// downsampled series (the complete per-minute data is available from /reportcsvmxm)
+namespace ReportHTMLCompact
+{
+	bool SaveSimulationReport(const std::wstring, FastPassType);
+
+	std::vector<int> LargestTriangleThreeBuckets(const std::vector<int>&, int);
+
+	namespace
+	{
+		void Summary(ReportWriter&);
+
+		void TicketList(ReportWriter&);
+		void RideList(ReportWriter&);
+		void EateryList(ReportWriter&);
+		void DailyStatsList(ReportWriter&, const std::wstring, const std::vector<std::wstring>&, DailyStatistics*);
+		void VisitorRideList(ReportWriter&);
+		void MinuteByMinute(ReportWriter&, FastPassType);
+
+		void Series(ReportWriter&, const std::wstring, const std::vector<int>&);
+
+		void String(ReportWriter&, const std::wstring&);
+		void Number(ReportWriter&, double);
+	}
+};
\ No newline at end of file
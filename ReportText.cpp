@@ -10,15 +10,17 @@
 // =======================================================================
 
 
-#include <fstream>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "Configuration.h"
 #include "Constants.h"
 #include "ParkController.h"
 #include "QWaitTypes.h"
+#include "ReportController.h"
 #include "ReportText.h"
+#include "ReportWriter.h"
 #include "Utility.h"
 #include "VisitorController.h"
 
@@ -27,20 +29,19 @@ extern ParkController* GParkController;
 extern VisitorController* GVisitorController;
 
 extern Configuration* GConfiguration;
+extern ReportController* GReportController;
 
 
 namespace ReportText
 {
 	void ReportText::SaveSimulationReport(const std::wstring file_name, FastPassType fast_pass_mode)
 	{
-		std::wofstream file(file_name);
+		ReportWriter file(file_name);
 
 		if (file)
 		{
 			OutputStatus(L"Saving Simulation report...");
 
-			GVisitorController->CalculateStatistics(GParkController->TotalEaterySpending());
-
 			// =======================================================================================================================
 
 			file << "        Simulation Report, Created " << Utility::DateTime(kDisplayModeConsole) << "\n";
@@ -243,11 +244,17 @@ namespace ReportText
 				file << "    Selection choice cache (ride vs frequency of ride choice)" << "\n";
 				file << "\n";
 
-				int freq[Constants::MaxRideCount] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }; // max of 30 rides ;)
+				std::vector<int> freq(GParkController->Rides.size(), 0);
 
 				for (int i = 0; i < kSelectionChoiceCacheCount; i++)
 				{
-					freq[GParkController->SelectionChoiceCache[t][i]]++;
+					int ride = GParkController->SelectionChoiceCache[t][i];
+
+					// a park with no rides (e.g. every ride in the template rejected) has nothing valid in the cache
+					if (ride >= 0 && ride < freq.size())
+					{
+						freq[ride]++;
+					}
 				}
 
 				for (int r = 0; r < GParkController->Rides.size(); r++)
@@ -337,7 +344,7 @@ namespace ReportText
 
 			// =======================================================================================================================
 
-			file.close();
+			file.Close();
 		}
 		else
 		{
@@ -348,7 +355,7 @@ namespace ReportText
 
 	void ReportText::SaveMxMReport(const std::wstring file_name, FastPassType fast_pass_mode)
 	{
-		std::wofstream file(file_name);
+		ReportWriter file(file_name);
 
 		if (file)
 		{
@@ -356,7 +363,7 @@ namespace ReportText
 				
 			for (int m = 0; m < GParkController->Rides[0].GetMinuteStatsCount(); m++)
 			{
-				MinuteDataV mdv = GVisitorController->GetMinuteDataStructFor(m);
+				const MinuteDataV& mdv = GVisitorController->GetMinuteDataStructFor(m);
 
 				if (GConfiguration->FastPassMode == FastPassType::None)
 				{
@@ -368,7 +375,7 @@ namespace ReportText
 				}
 			}
 
-			file.close();
+			file.Close();
 		}
 		else
 		{
@@ -377,7 +384,7 @@ namespace ReportText
 	}
 
 
-	void ReportText::MxMRow(std::wofstream& file, MinuteDataV mdv)
+	void ReportText::MxMRow(ReportWriter& file, const MinuteDataV& mdv)
 	{
 		std::wstring pIdle    = L" n/a";
 		std::wstring pTravel  = L" n/a";
@@ -394,11 +401,11 @@ namespace ReportText
 			pBusy    = Utility::PadRight(static_cast<int>((double)(mdv.waiting) / (double)(mdv.visitorsInPark)) * 100.0, 3) + L"%";
 		}
 
-		file << Utility::PadRight(mdv.time, 6) << L"  In park : " << Utility::PadRight(mdv.visitorsInPark, 6) << L"  Idle : " << Utility::PadRight(mdv.idle, 6) << L" (" << pIdle << L")  Travelling : " << Utility::PadRight(mdv.travelling, 6) << L" (" << pTravel << L")  Queuing : " << Utility::PadRight(mdv.queuing, 6) << L" (" << pQueuing << L")  Riding : " << Utility::PadRight(mdv.travelling, 6) << L" (" << pRiding << L")    Busy : " << Utility::PadRight(mdv.waiting, 6) << L" (" << pIdle << L")  Average Rides : " << Utility::PadRight(mdv.averageRides, 3) << "\n";
+		file << Utility::PadRight(Utility::FormatTime(mdv.time), 6) << L"  In park : " << Utility::PadRight(mdv.visitorsInPark, 6) << L"  Idle : " << Utility::PadRight(mdv.idle, 6) << L" (" << pIdle << L")  Travelling : " << Utility::PadRight(mdv.travelling, 6) << L" (" << pTravel << L")  Queuing : " << Utility::PadRight(mdv.queuing, 6) << L" (" << pQueuing << L")  Riding : " << Utility::PadRight(mdv.travelling, 6) << L" (" << pRiding << L")    Busy : " << Utility::PadRight(mdv.waiting, 6) << L" (" << pIdle << L")  Average Rides : " << Utility::PadRight(mdv.averageRides, 3) << "\n";
 	}
 
 
-	void ReportText::MxMRowFP(std::wofstream& file, MinuteDataV mdv)
+	void ReportText::MxMRowFP(ReportWriter& file, const MinuteDataV& mdv)
 	{
 		std::wstring pIdle      = L" n/a";
 		std::wstring pTravel    = L" n/a";
@@ -417,15 +424,13 @@ namespace ReportText
 			pBusy      = Utility::PadRight(static_cast<int>((double)(mdv.waiting) / (double)(mdv.visitorsInPark)) * 100.0, 3) + L"%";
 		}
 
-		file << Utility::PadRight(mdv.time, 6) << L"  In park : " << Utility::PadRight(mdv.visitorsInPark, 6) << L"  Idle : " << Utility::PadRight(mdv.idle, 6) << L" (" << pIdle << L")  Travelling : " << Utility::PadRight(mdv.travelling, 6) << L" (" << pTravel << L")  Queuing : " << Utility::PadRight(mdv.queuing, 6) << L" (" << pQueuing << L")  Queuing : " << Utility::PadRight(mdv.queuingFastPass, 6) << L" (" << pQueuingFP << L")  Riding : " << Utility::PadRight(mdv.travelling, 6) << L" (" << pRiding << L")    Busy : " << Utility::PadRight(mdv.waiting, 6) << L" (" << pIdle << L")  Average Rides : " << Utility::PadRight(mdv.averageRides, 3) << "\n";
+		file << Utility::PadRight(Utility::FormatTime(mdv.time), 6) << L"  In park : " << Utility::PadRight(mdv.visitorsInPark, 6) << L"  Idle : " << Utility::PadRight(mdv.idle, 6) << L" (" << pIdle << L")  Travelling : " << Utility::PadRight(mdv.travelling, 6) << L" (" << pTravel << L")  Queuing : " << Utility::PadRight(mdv.queuing, 6) << L" (" << pQueuing << L")  Queuing : " << Utility::PadRight(mdv.queuingFastPass, 6) << L" (" << pQueuingFP << L")  Riding : " << Utility::PadRight(mdv.travelling, 6) << L" (" << pRiding << L")    Busy : " << Utility::PadRight(mdv.waiting, 6) << L" (" << pIdle << L")  Average Rides : " << Utility::PadRight(mdv.averageRides, 3) << "\n";
 	}
 
 
+	// reports may be generated concurrently, so status goes through the (locked) report controller
 	void ReportText::OutputStatus(const std::wstring status)
 	{
-		if (!GConfiguration->DebugConfig.DisableConsoleOutput)
-		{
-			std::wcout << status << std::endl;
-		}
+		GReportController->OutputStatus(status);
 	}
 }
\ No newline at end of file
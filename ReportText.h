@@ -16,6 +16,7 @@
 #include <string>
 
 #include "QWaitTypes.h"
+#include "ReportWriter.h"
 #include "VisitorController.h"
 
 
@@ -25,8 +26,8 @@ namespace ReportText
 
 	void SaveMxMReport(const std::wstring, FastPassType);
 
-	void MxMRow(std::wofstream& file, MinuteDataV mdv);
-	void MxMRowFP(std::wofstream& file, MinuteDataV mdv);
+	void MxMRow(ReportWriter& file, const MinuteDataV& mdv);
+	void MxMRowFP(ReportWriter& file, const MinuteDataV& mdv);
 
 	void OutputStatus(const std::wstring);
 }
\ No newline at end of file
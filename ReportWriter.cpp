@@ -0,0 +1,398 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include <charconv>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "ReportWriter.h"
+
+
+namespace
+{
+	// large enough for any 64-bit integer, or a double in %g format
+	static const int kNumberBufferSize = 32;
+
+	template <typename T>
+	void AppendInteger(std::string& buffer, T value)
+	{
+		char temp[kNumberBufferSize];
+
+		std::to_chars_result result = std::to_chars(temp, temp + kNumberBufferSize, value);
+
+		buffer.append(temp, result.ptr);
+	}
+}
+
+
+ReportWriter::ReportWriter()
+{
+}
+
+
+ReportWriter::ReportWriter(const std::wstring file_name)
+{
+	if (file_name.size() > 3 && file_name.compare(file_name.size() - 3, 3, L".gz") == 0)
+	{
+		File.open(std::filesystem::path(file_name), std::ios::binary);
+
+		if (File)
+		{
+			Compressor = std::make_unique<GZipStream>(File);
+		}
+	}
+	else
+	{
+		File.open(std::filesystem::path(file_name));
+	}
+
+	Buffer.reserve(kReportWriterBufferSize + 1024);
+}
+
+
+ReportWriter::~ReportWriter()
+{
+	Close();
+}
+
+
+ReportWriter::operator bool() const
+{
+	return File.is_open() && File.good();
+}
+
+
+// the compressor takes ownership of the block, so a fresh buffer is started
+void ReportWriter::WriteBlock(std::string& block)
+{
+	if (Compressor)
+	{
+		Compressor->Write(std::move(block));
+
+		block = std::string();
+		block.reserve(kReportWriterBufferSize + 1024);
+	}
+	else
+	{
+		File.write(block.data(), block.size());
+
+		block.clear();
+	}
+}
+
+
+void ReportWriter::Flush()
+{
+	if (Buffer.size() != 0)
+	{
+		WriteBlock(Buffer);
+	}
+}
+
+
+void ReportWriter::Close()
+{
+	if (File.is_open())
+	{
+		Flush();
+
+		if (Compressor)
+		{
+			Compressor->Close();
+		}
+
+		File.close();
+	}
+}
+
+
+// memory only writers keep everything until they are appended to a file writer
+void ReportWriter::FlushIfFull()
+{
+	if (Buffer.size() >= kReportWriterBufferSize && File.is_open())
+	{
+		Flush();
+	}
+}
+
+
+// writes the contents of another (usually memory only) writer, leaving it empty
+void ReportWriter::Append(ReportWriter& chunk)
+{
+	if (File.is_open())
+	{
+		Flush();
+
+		if (Compressor)
+		{
+			Compressor->Write(std::move(chunk.Buffer));
+		}
+		else
+		{
+			File.write(chunk.Buffer.data(), chunk.Buffer.size());
+		}
+	}
+	else
+	{
+		Buffer.append(chunk.Buffer);
+	}
+
+	chunk.Buffer.clear();
+}
+
+
+// splits items [0, item_count) in to chunks of chunk_size and formats each chunk in to its own
+// buffer on a worker thread. chunks are written strictly in order as they complete, so the output
+// is byte-identical to formatting every item here in one pass. at most two chunks per thread are
+// in flight, which bounds memory use on very large reports.
+void ReportWriter::WriteChunked(size_t item_count, size_t chunk_size, std::function<void(ReportWriter&, size_t, size_t)> format)
+{
+	if (chunk_size == 0)
+	{
+		chunk_size = 1;
+	}
+
+	size_t max_in_flight = std::thread::hardware_concurrency() * 2;
+
+	if (max_in_flight < 2)
+	{
+		max_in_flight = 2;
+	}
+
+	std::deque<std::future<std::unique_ptr<ReportWriter>>> pending;
+
+	size_t next = 0;
+
+	while (next < item_count || pending.size() != 0)
+	{
+		while (next < item_count && pending.size() < max_in_flight)
+		{
+			size_t first = next;
+			size_t last = next + chunk_size;
+
+			if (last > item_count)
+			{
+				last = item_count;
+			}
+
+			pending.push_back(std::async(std::launch::async, [first, last, &format]()
+				{
+					std::unique_ptr<ReportWriter> chunk = std::make_unique<ReportWriter>();
+
+					format(*chunk, first, last);
+
+					return chunk;
+				}));
+
+			next = last;
+		}
+
+		std::unique_ptr<ReportWriter> chunk = pending.front().get();
+
+		pending.pop_front();
+
+		Append(*chunk);
+	}
+}
+
+
+// handles both UTF-16 (Windows) and UTF-32 wchar_t
+void ReportWriter::AppendUTF8(const wchar_t* text, size_t length)
+{
+	for (size_t i = 0; i < length; i++)
+	{
+		unsigned int c = static_cast<unsigned int>(text[i]);
+
+		if (c < 0x80)
+		{
+			Buffer.push_back(static_cast<char>(c));
+
+			continue;
+		}
+
+		if (c >= 0xD800 && c <= 0xDBFF && i + 1 < length)
+		{
+			unsigned int low = static_cast<unsigned int>(text[i + 1]);
+
+			if (low >= 0xDC00 && low <= 0xDFFF)
+			{
+				c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+
+				i++;
+			}
+		}
+
+		if (c < 0x800)
+		{
+			Buffer.push_back(static_cast<char>(0xC0 | (c >> 6)));
+			Buffer.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+		}
+		else if (c < 0x10000)
+		{
+			Buffer.push_back(static_cast<char>(0xE0 | (c >> 12)));
+			Buffer.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+			Buffer.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+		}
+		else
+		{
+			Buffer.push_back(static_cast<char>(0xF0 | (c >> 18)));
+			Buffer.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
+			Buffer.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+			Buffer.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+		}
+	}
+}
+
+
+// =======================================================================================================================
+// =======================================================================================================================
+
+
+ReportWriter& ReportWriter::operator<<(const char* text)
+{
+	Buffer.append(text);
+
+	FlushIfFull();
+
+	return *this;
+}
+
+
+ReportWriter& ReportWriter::operator<<(std::string_view text)
+{
+	Buffer.append(text.data(), text.size());
+
+	FlushIfFull();
+
+	return *this;
+}
+
+
+ReportWriter& ReportWriter::operator<<(char c)
+{
+	Buffer.push_back(c);
+
+	FlushIfFull();
+
+	return *this;
+}
+
+
+ReportWriter& ReportWriter::operator<<(const wchar_t* text)
+{
+	AppendUTF8(text, std::char_traits<wchar_t>::length(text));
+
+	FlushIfFull();
+
+	return *this;
+}
+
+
+ReportWriter& ReportWriter::operator<<(const std::wstring& text)
+{
+	AppendUTF8(text.data(), text.size());
+
+	FlushIfFull();
+
+	return *this;
+}
+
+
+// matches the stream default (no boolalpha)
+ReportWriter& ReportWriter::operator<<(bool value)
+{
+	Buffer.push_back(value ? '1' : '0');
+
+	FlushIfFull();
+
+	return *this;
+}
+
+
+ReportWriter& ReportWriter::operator<<(int value)
+{
+	AppendInteger(Buffer, value);
+
+	FlushIfFull();
+
+	return *this;
+}
+
+
+ReportWriter& ReportWriter::operator<<(unsigned int value)
+{
+	AppendInteger(Buffer, value);
+
+	FlushIfFull();
+
+	return *this;
+}
+
+
+ReportWriter& ReportWriter::operator<<(long value)
+{
+	AppendInteger(Buffer, value);
+
+	FlushIfFull();
+
+	return *this;
+}
+
+
+ReportWriter& ReportWriter::operator<<(unsigned long value)
+{
+	AppendInteger(Buffer, value);
+
+	FlushIfFull();
+
+	return *this;
+}
+
+
+ReportWriter& ReportWriter::operator<<(long long value)
+{
+	AppendInteger(Buffer, value);
+
+	FlushIfFull();
+
+	return *this;
+}
+
+
+ReportWriter& ReportWriter::operator<<(unsigned long long value)
+{
+	AppendInteger(Buffer, value);
+
+	FlushIfFull();
+
+	return *this;
+}
+
+
+// same output as the stream default (%g, 6 significant digits)
+ReportWriter& ReportWriter::operator<<(double value)
+{
+	char temp[kNumberBufferSize];
+
+	std::to_chars_result result = std::to_chars(temp, temp + kNumberBufferSize, value, std::chars_format::general, 6);
+
+	Buffer.append(temp, result.ptr);
+
+	FlushIfFull();
+
+	return *this;
+}
\ No newline at end of file
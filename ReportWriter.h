@@ -0,0 +1,77 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "GZip.h"
+
+
+static const size_t kReportWriterBufferSize = 4 * 1024 * 1024;	// bytes collected before a block is written to disk
+
+
+// formats report output straight in to a UTF-8 byte buffer (integers via to_chars)
+// and writes it to disk in large blocks, avoiding the per-character conversion of std::wofstream.
+// a writer created without a file name is memory only, used to format chunks of a report on worker threads.
+// file names ending ".gz" are gzip compressed on a separate thread as the report is written
+class ReportWriter
+{
+	std::ofstream File;
+
+	std::unique_ptr<GZipStream> Compressor;
+
+	std::string Buffer;
+
+	void AppendUTF8(const wchar_t*, size_t);
+
+	void WriteBlock(std::string&);
+
+	void FlushIfFull();
+
+public:
+
+	ReportWriter();
+	ReportWriter(const std::wstring);
+	~ReportWriter();
+
+	explicit operator bool() const;
+
+	void Flush();
+	void Close();
+
+	void Append(ReportWriter&);
+
+	void WriteChunked(size_t, size_t, std::function<void(ReportWriter&, size_t, size_t)>);
+
+	ReportWriter& operator<<(const char*);
+	ReportWriter& operator<<(std::string_view);
+	ReportWriter& operator<<(char);
+
+	ReportWriter& operator<<(const wchar_t*);
+	ReportWriter& operator<<(const std::wstring&);
+
+	ReportWriter& operator<<(bool);
+	ReportWriter& operator<<(int);
+	ReportWriter& operator<<(unsigned int);
+	ReportWriter& operator<<(long);
+	ReportWriter& operator<<(unsigned long);
+	ReportWriter& operator<<(long long);
+	ReportWriter& operator<<(unsigned long long);
+
+	ReportWriter& operator<<(double);
+};
\ No newline at end of file
@@ -107,7 +107,7 @@ void Ride::InitFastPass()
 	{
 		for (int h = 0; h < 24; h++)
 		{
-			if (RideOperation.open.hours <= h && RideOperation.close.hours > h)
+			if (QWaitTypes::Hour(RideOperation.open) <= h && QWaitTypes::Hour(RideOperation.close) > h)
 			{
 				FastPass.ticketsLeftFoHour[h] = ResetFastPassTicketsLeft();
 			}
@@ -142,6 +142,9 @@ void Ride::ConfigureThroughput(int hourly_throughput)
 
 		RideThroughput.perMinuteFastPass = ((double)hourly_throughput * (Constants::FastPassHourlyPercent / 100.0)) / 60.0;
 		RideThroughput.perMinuteIFastPass = static_cast<int>(std::lround(RideThroughput.perMinuteFastPass));
+
+		RideThroughput.perHourX100 = std::llround((double)hourly_throughput * Constants::StandardHourlyPercent);
+		RideThroughput.perHourX100FastPass = std::llround((double)hourly_throughput * Constants::FastPassHourlyPercent);
 	}
 	else
 	{
@@ -152,7 +155,35 @@ void Ride::ConfigureThroughput(int hourly_throughput)
 
 		RideThroughput.perMinuteFastPass = 0.0;
 		RideThroughput.perMinuteIFastPass = 0;
+
+		RideThroughput.perHourX100 = (int64_t)hourly_throughput * 100;
+		RideThroughput.perHourX100FastPass = 0;
+	}
+}
+
+
+void Ride::SetTicksPerMinute(int ticks_per_minute)
+{
+	RideThroughput.ticksPerMinute = ticks_per_minute;
+}
+
+
+// riders the standard (or fastpass) queue may have loaded between the start of the minute and the end
+// of tick minute_tick; day_tick counts ticks from the park opening. with one tick a minute this is the
+// rounded per-minute throughput, as it always was. finer ticks share out the exact hourly throughput,
+// so a low-capacity ride no longer gains or loses the rounding every minute
+int Ride::CapacityToTick(int day_tick, int minute_tick, bool fast_pass)
+{
+	if (RideThroughput.ticksPerMinute == 1)
+	{
+		return fast_pass ? RideThroughput.perMinuteIFastPass : RideThroughput.perMinuteI;
 	}
+
+	int64_t per_hour_x100 = fast_pass ? RideThroughput.perHourX100FastPass : RideThroughput.perHourX100;
+	int64_t ticks_per_hour_x100 = (int64_t)6000 * RideThroughput.ticksPerMinute;
+	int64_t minute_start = day_tick - minute_tick;
+
+	return static_cast<int>((per_hour_x100 * (day_tick + 1)) / ticks_per_hour_x100 - (per_hour_x100 * minute_start) / ticks_per_hour_x100);
 }
 
 
@@ -268,7 +299,7 @@ int Ride::QueueSizeFastPass()
 // returns 24-hour clock time, valid for 1 hour
 int Ride::GetFastPassTicket(QWaitTypes::Time arrive, QWaitTypes::Time leave)
 {
-	for (int h = arrive.hours; h < leave.hours; h++)
+	for (int h = QWaitTypes::Hour(arrive); h < QWaitTypes::Hour(leave); h++)
 	{
 		if (FastPass.ticketsLeftFoHour[h] != 0)
 		{
@@ -286,7 +317,7 @@ int Ride::GetFastPassTicket(QWaitTypes::Time arrive, QWaitTypes::Time leave)
 // currenttime refers to a one hour slot from CurrentTime to CurrentTime + 1 (24-hour clock)
 int Ride::ViewFastPassTicket(QWaitTypes::Time arrive, QWaitTypes::Time leave)
 {
-	for (int h = arrive.hours; h < leave.hours; h++)
+	for (int h = QWaitTypes::Hour(arrive); h < QWaitTypes::Hour(leave); h++)
 	{
 		if (FastPass.ticketsLeftFoHour[h] != 0)
 		{
@@ -350,9 +381,7 @@ void Ride::UpdateDailyStatistics()
 }
 
 
-std::wstring Ride::GetMinuteStatFor(int minute)
+const MinuteData& Ride::GetMinuteStatStructFor(int minute)
 {
-	return std::to_wstring(Statistics[minute].queueSize) + L"," +
-	       std::to_wstring(Statistics[minute].riders) + L"," +
-		   std::to_wstring(Statistics[minute].waitTimeMinutes);
+	return Statistics[minute];
 }
\ No newline at end of file
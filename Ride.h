@@ -13,6 +13,7 @@
 #pragma once
 
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -41,8 +42,8 @@ struct Operation {
 
 	bool isShutdown = 0;			 // after closed for the day
 
-	QWaitTypes::Time open = { 0, 0 };
-	QWaitTypes::Time close = { 0, 0 };
+	QWaitTypes::Time open = 0;
+	QWaitTypes::Time close = 0;
 
 	int ShowStartTime = 0; // for show type rides only, every x minutes
 
@@ -50,6 +51,10 @@ struct Operation {
 
 	int Popularity = 0;            //
 
+	int templateID = 0;				 // ride number in the template file it was loaded from, 0 for built-in parks
+
+	bool ownHours = false;			 // open/close set by the park rather than the park's opening hours
+
 	bool BabyValid = false;
 	bool ChildValid = false;
 	bool AdultValid = false;	
@@ -83,6 +88,7 @@ struct DailyData {
 
 struct FastPassSystem {
 	int mode = 0;					// 0 - inactive, or type x
+	int parkMode = 0;				// the mode the park gives the ride; mode is 0 when the simulation runs without fastpass
 	int percentage = 0;
 
 	int ticketsLeftFoHour[24] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
@@ -101,6 +107,10 @@ struct Capacity {
 
 	int showCapacity = 0;
 	int showCapacityFastPass = 0;
+
+	int ticksPerMinute = 1;			// engine ticks per minute
+	int64_t perHourX100 = 0;		// riders per hour x 100, shared out over the ticks when there's more than one a minute
+	int64_t perHourX100FastPass = 0;
 };
 
 
@@ -124,6 +134,9 @@ public:
 	
 	int CurrentRiders;			
 
+	int LoadedThisMinute = 0;			// riders loaded so far this minute, by queue
+	int LoadedThisMinuteFastPass = 0;
+
 	FastPassSystem FastPass;
 
 	DailyData DailyStatistics;
@@ -138,6 +151,9 @@ public:
 
 	void ConfigureShowThroughput(int, int);
 
+	void SetTicksPerMinute(int);
+	int CapacityToTick(int, int, bool);
+
 	void AddToQueue(QWaitTypes::Riders);
 	QWaitTypes::Riders RemoveFromQueue();
 	QWaitTypes::Riders NextItemInQueue(); // doesn't remove, gives information on next item
@@ -157,7 +173,7 @@ public:
 
 	size_t GetMinuteStatsCount();
 
-	std::wstring GetMinuteStatFor(int);
+	const MinuteData& GetMinuteStatStructFor(int);
 	void UpdateMinuteStats();
 
 	void UpdateDailyStatistics();
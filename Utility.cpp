@@ -93,20 +93,7 @@ namespace Utility
 
 	std::wstring FormatTime(QWaitTypes::Time time)
 	{
-		std::wstring h = std::to_wstring(time.hours);
-		std::wstring m = std::to_wstring(time.minutes);
-
-		if (time.hours < 10)
-		{
-			h = L"0" + h;
-		}
-
-		if (time.minutes < 10)
-		{
-			m = L"0" + m;
-		}
-
-		return h + L":" + m;
+		return FormatTime(QWaitTypes::Hour(time), QWaitTypes::Minute(time));
 	}
 
 
@@ -146,33 +133,12 @@ namespace Utility
 	}
 
 
-	// duration in minutes between From and To
-	int Duration(QWaitTypes::Time from, QWaitTypes::Time to)
-	{
-		return static_cast<int>(((double)to.hours - (double)from.hours) * 60.0 + (to.minutes - from.minutes));
-	}
-
-
-	bool IsTimeEqual(QWaitTypes::Time base, QWaitTypes::Time compare_to)
-	{
-		if (base.hours == compare_to.hours && base.minutes == compare_to.minutes)
-		{
-			return true;
-		}
-
-		return false;
-	}
-
-
 	// returns true if CompareTo is between Ealiest and Latest (with a one hour margin of error)
 	bool IsTicketValidForTime(QWaitTypes::Time earliest, QWaitTypes::Time latest, QWaitTypes::Time compare_to)
 	{
-		int e = (earliest.hours * 60) + earliest.minutes;
-		int l = (latest.hours * 60) + latest.minutes;
-		int q = (compare_to.hours * 60) + compare_to.minutes;
-		int z = ((compare_to.hours + 1) * 60) + compare_to.minutes;
+		QWaitTypes::Time z = compare_to + 60;
 
-		if ((q >= e && q <= l) || (z >= e && z <= l))
+		if ((compare_to >= earliest && compare_to <= latest) || (z >= earliest && z <= latest))
 		{
 			return true;
 		}
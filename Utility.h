@@ -32,10 +32,6 @@ namespace Utility
 	std::wstring PadRight(const std::wstring, int);
 	std::wstring PadRight(int, int);
 
-	int Duration(QWaitTypes::Time, QWaitTypes::Time);
-
-	bool IsTimeEqual(QWaitTypes::Time, QWaitTypes::Time);
-
 	bool IsTicketValidForTime(QWaitTypes::Time, QWaitTypes::Time, QWaitTypes::Time);
 
 	std::wstring GetMD5(const std::wstring);
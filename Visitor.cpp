@@ -10,6 +10,8 @@
 // =======================================================================
 
 
+#include <cmath>
+
 #include "Constants.h"
 #include "Visitor.h"
 
@@ -17,12 +19,11 @@
 Visitor::Visitor(NewVisitorConfiguration type_configuration)
 {
 	Configuration.Type = type_configuration.type;
-	Configuration.TypeInt = QWaitTypes::VisitorTypeToInt(type_configuration.type);
 
 	Configuration.Age = type_configuration.age;
 
-	Rides.maxWaitTime = type_configuration.maxWaitTime;
-	Rides.preference  = type_configuration.preference;
+	Rides.maxWaitTime = static_cast<float>(type_configuration.maxWaitTime);
+	Rides.preference  = static_cast<float>(type_configuration.preference);
 
 	SetDefaults();
 }
@@ -32,11 +33,6 @@ void Visitor::SetDefaults()
 {
 	ParkStatus = VisitorParkStatus::OnWay;
 
-	Configuration.Location.x = -1;
-	Configuration.Location.y = -1;
-
-	WaitingTime = 0;
-
 	Rides.noRideAvailable = 0;
 	Rides.rideShutdown = 0;
 	Rides.waitTimeTooLong = 0;
@@ -45,10 +41,10 @@ void Visitor::SetDefaults()
 	Rides.count = 0;
 	Rides.fastPassRides = 0;
 
-	Rides.shortestQueue = 9999.0;
-	Rides.longestQueue = 0.0;
+	Rides.shortestQueue = kNoQueueRecorded;
+	Rides.longestQueue = 0;
 
-	Rides.shortestQueueFastPass = 9999;
+	Rides.shortestQueueFastPass = kNoQueueRecorded;
 	Rides.longestQueueFastPass = 0;
 
 	TimeSpent.idle = 0;
@@ -61,16 +57,35 @@ void Visitor::SetDefaults()
 }
 
 
+// queue lengths are kept as whole minutes, clamped below the "no queue" marker
+uint16_t Visitor::QueueMinutes(double queue_length)
+{
+	if (queue_length <= 0.0)
+	{
+		return 0;
+	}
+
+	if (queue_length >= kNoQueueRecorded - 1)
+	{
+		return kNoQueueRecorded - 1;
+	}
+
+	return static_cast<uint16_t>(std::lround(queue_length));
+}
+
+
 void Visitor::SetQueuingLengthStat(double queue_length)
 {
-	if (queue_length > Rides.longestQueue)
+	uint16_t minutes = QueueMinutes(queue_length);
+
+	if (minutes > Rides.longestQueue)
 	{
-		Rides.longestQueue = queue_length;
+		Rides.longestQueue = minutes;
 	}
 
-	if (queue_length < Rides.shortestQueue)
+	if (minutes < Rides.shortestQueue)
 	{
-		Rides.shortestQueue = queue_length;
+		Rides.shortestQueue = minutes;
 	}
 
 	ParkStatus = VisitorParkStatus::Queuing;
@@ -79,14 +94,16 @@ void Visitor::SetQueuingLengthStat(double queue_length)
 
 void Visitor::SetQueuingFastPassLengthStat(double queue_length)
 {
-	if (queue_length > Rides.longestQueueFastPass)
+	uint16_t minutes = QueueMinutes(queue_length);
+
+	if (minutes > Rides.longestQueueFastPass)
 	{
-		Rides.longestQueueFastPass = queue_length;
+		Rides.longestQueueFastPass = minutes;
 	}
 
-	if (queue_length < Rides.shortestQueueFastPass)
+	if (minutes < Rides.shortestQueueFastPass)
 	{
-		Rides.shortestQueueFastPass = queue_length;
+		Rides.shortestQueueFastPass = minutes;
 	}
 
 	ParkStatus = VisitorParkStatus::QueuingFastPass;
@@ -13,15 +13,22 @@
 #pragma once
 
 
+#include <cstdint>
 #include <vector>
 
 #include "Constants.h"
+#include "Names.h"
 #include "QWaitTypes.h"
 
 
-enum class AgeGroup { Baby = 0, Child = 1, Adult = 2 };
+static const int kVisitorStateBudget = 80;			// bytes per visitor, excluding the ride list's heap storage
 
-enum class VisitorParkStatus {
+static const uint16_t kNoQueueRecorded = 9999;		// shortest queue before the visitor has queued for anything
+
+
+enum class AgeGroup : uint8_t { Baby = 0, Child = 1, Adult = 2 };
+
+enum class VisitorParkStatus : uint8_t {
 	OnWay = 0, AtEntrance = 1, Idle = 2, Riding = 3, Queuing = 4, QueuingFastPass = 5, QueuingFood = 6,
 	TravellingRide = 7, Waiting = 8, TravellingFood = 9, Eating = 10, WaitingForOthersInParty = 11, Exited = 12
 };
@@ -39,61 +46,63 @@ struct NewVisitorConfiguration {
 };
 
 
+// minutes; a day fits comfortably in 16 bits
 struct TimeStats {
-	int idle = 0;
-	int riding = 0;
-	int travelling = 0;
-	int travellingFood = 0;
-	int queuing = 0;
-	int queuingFood = 0;
-	int waiting = 0;
-	int eating = 0;
+	uint16_t idle = 0;
+	uint16_t riding = 0;
+	uint16_t travelling = 0;
+	uint16_t travellingFood = 0;
+	uint16_t queuing = 0;
+	uint16_t queuingFood = 0;
+	uint16_t waiting = 0;
+	uint16_t eating = 0;
 };
 
 
 struct RideStats {
-	double maxWaitTime = 0.0;    // max wait time for a ride (minutes)
-	double preference = 0.0;     // scale from 0 = rides only, 1 = attractions only (actually high priority to low)
+	float maxWaitTime = 0.0f;    // max wait time for a ride (minutes)
+	float preference = 0.0f;     // scale from 0 = rides only, 1 = attractions only (actually high priority to low)
 
-	int count = 0;
+	uint32_t distanceTravelled = 0; // metres
 
-	int noRideAvailable = 0;
-	int waitTimeTooLong = 0;
-	int rideShutdown = 0;
-	int distanceTravelled = 0; // metres
-	int noFastPassRideForMe = 0;
-	int nooneCanRideInGroup = 0;
-	int rideNotSuitableForMe = 0;
-	int eateryQueueTooLong = 0;
+	uint16_t count = 0;
 
-	double shortestQueue = 0.0;
-	double longestQueue = 0.0;
+	uint16_t noRideAvailable = 0;
+	uint16_t waitTimeTooLong = 0;
+	uint16_t rideShutdown = 0;
+	uint16_t noFastPassRideForMe = 0;
+	uint16_t nooneCanRideInGroup = 0;
+	uint16_t rideNotSuitableForMe = 0;
+	uint16_t eateryQueueTooLong = 0;
 
-	double shortestQueueFastPass = 0.0;
-	double longestQueueFastPass = 0.0;
+	uint16_t shortestQueue = kNoQueueRecorded;	// minutes
+	uint16_t longestQueue = 0;
 
-	int fastPassRides = 0;
+	uint16_t shortestQueueFastPass = kNoQueueRecorded;
+	uint16_t longestQueueFastPass = 0;
 
-	int currentRide = Constants::kNoSelectedRide;
+	uint16_t fastPassRides = 0;
 
-	int eateriesVisited = 0;
+	int16_t currentRide = Constants::kNoSelectedRide;
+
+	uint16_t eateriesVisited = 0;
 };
 
 
 struct VisitorConfiguration {
 
-	AgeGroup Age = AgeGroup::Baby;
-
-	VisitorType Type = VisitorType::Enthusiast;
-	int TypeInt = 0;
-
 	int MoneySpent = 0;	
 
-	std::wstring Name;
+	uint16_t FirstName = kNoName;	// indices in to VisitorController::VisitorNames
+	uint16_t LastName = kNoName;
 
-	QWaitTypes::Coords Location;
+	AgeGroup Age : 2;				// set by the Visitor constructor (bit-fields can't have initialisers)
+	VisitorType Type : 3;
 
-	int StayDuration;
+	int GetTypeAsInt() const
+	{
+		return static_cast<int>(Type);
+	}
 
 	int GetAgeAsInt()
 	{
@@ -130,20 +139,20 @@ struct VisitorConfiguration {
 class Visitor
 {
 	void SetDefaults();
+
+	uint16_t QueueMinutes(double);
 	
 public:
 
-	VisitorConfiguration Configuration;
+	std::vector<uint16_t> RideList;	// list of every ride this visitor has ridden today
 
-	std::vector<int> RideList;		// list of every ride this visitor has ridden today
-
-	VisitorParkStatus ParkStatus;	//
+	RideStats Rides;
 
 	TimeStats TimeSpent;
 
-	RideStats Rides;
+	VisitorConfiguration Configuration;
 
-	int WaitingTime;				// minutes to wait
+	VisitorParkStatus ParkStatus;	//
 		
 	Visitor(NewVisitorConfiguration);
 
@@ -151,4 +160,8 @@ public:
 	void SetQueuingFastPassLengthStat(double);
 	
 	void BuyItem(int cost);
-};
\ No newline at end of file
+};
+
+
+// the per-minute loops walk every visitor, so keep the record small
+static_assert(sizeof(Visitor) - sizeof(std::vector<uint16_t>) <= kVisitorStateBudget, "Visitor has outgrown its size budget");
\ No newline at end of file
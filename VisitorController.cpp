@@ -10,15 +10,24 @@
 // =======================================================================
 
 
+#include <algorithm>
+#include <charconv>
+#include <cstring>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <iterator>
 #include <random>
 #include <sstream>
+#include <string_view>
+#include <thread>
 #include <time.h>
 
 #include "Constants.h"
 #include "Group.h"
+#include "MappedFile.h"
 #include "Names.h"
+#include "PopulationFile.h"
 #include "QWaitTypes.h"
 #include "ReportUtility.h"
 #include "Utility.h"
@@ -52,6 +61,16 @@ void VisitorController::SetDefaults()
 	{
 		DailyStats.rideCount[x] = 0;
 	}
+
+	for (int t = 0; t < Constants::AvailableGroupTypes; t++)
+	{
+		GroupTypeCount[t] = 0;
+	}
+
+	for (int t = 0; t < Constants::AvailableVisitorTypes; t++)
+	{
+		TypeCount[t] = 0;
+	}
 }
 
 
@@ -93,68 +112,151 @@ void VisitorController::Run(bool save_visitor_list, const std::wstring save_file
 	}
 	else
 	{
-		srand((unsigned)time(NULL));
+		if (GetVisitorName)
+		{
+			VisitorNames.LoadNames();
+		}
 
-		int visitor_count = 0;
+		GenerateVisitors();
+	}
 
-		while (visitor_count < ExpectedVisitorCount)
-		{
-			std::random_device rd;
-			std::default_random_engine eng(rd());
-			std::uniform_real_distribution<double> distr(0.0, 1.0);
+	if (save_visitor_list)
+	{
+		SaveVisitorList(save_file_name);
+	}
 
-			GroupType group_type = GetGroupType(distr(eng));
+	// generated visitors are counted as they are created
+	if (load_visitor_list)
+	{
+		CalculateDemographics();
+	}
 
-			Group group(group_type, TemplateIDint);
+	VisitorCountCreated = GetCurrentVisitorCount();
+	GroupCountCreated = Groups.size();
 
-			Groups.push_back(group);
+	HotState.Attach(Groups);
 
-			switch (group_type)
-			{
-			case GroupType::Family:
-				GroupTypeCount[0]++;
-				break;
-			case GroupType::AdultCouple:
-				GroupTypeCount[1]++;
-				break;
-			case GroupType::AdultGroup:
-				GroupTypeCount[2]++;
-				break;
-			case GroupType::Single:
-				GroupTypeCount[3]++;
-				break;
-			}
+	ShowConfig();
+}
 
-			visitor_count += group.Visitors.size();
-		}
 
-		/*
+// the population is split between threads, each filling its own block of groups from its own
+// random stream. blocks are then moved in to Groups in thread order and the per-thread group
+// and visitor type counts are summed
+void VisitorController::GenerateVisitors()
+{
+	int thread_count = std::thread::hardware_concurrency();
+
+	if (thread_count > ExpectedVisitorCount / kVisitorsPerGenerationThread)
+	{
+		thread_count = ExpectedVisitorCount / kVisitorsPerGenerationThread;
+	}
 
-		if (GetVisitorName)
+	if (thread_count < 1)
+	{
+		thread_count = 1;
+	}
+
+	std::random_device rd;
+
+	uint32_t seed = rd();
+
+	std::vector<GeneratedGroups> blocks(thread_count);
+	std::vector<std::future<void>> workers;
+
+	for (int t = 0; t < thread_count; t++)
+	{
+		int quota = ExpectedVisitorCount / thread_count;
+
+		if (t == 0)
 		{
-			Names NameController;
+			quota += ExpectedVisitorCount % thread_count;
+		}
 
-			if (NameController.LoadFirstNames && NameController.LoadLastNames)
-			{
-				for (int v = 0; v < Visitors.size(); v++)
-				{
-					Visitors[v].Name = NameController.GetRandomName();
-				}
-			}
-		}*/
+		workers.push_back(std::async(std::launch::async, &VisitorController::GenerateGroups, this, std::ref(blocks[t]), quota, seed, t));
 	}
 
-	if (save_visitor_list)
+	size_t group_count = 0;
+
+	for (int t = 0; t < thread_count; t++)
 	{
-		SaveVisitorList(save_file_name);
+		workers[t].get();
+
+		group_count += blocks[t].Groups.size();
 	}
 
-	CalculateDemographics();
+	Groups.reserve(Groups.size() + group_count);
 
-	VisitorCountCreated = GetCurrentVisitorCount();
-	GroupCountCreated = Groups.size();
+	for (int t = 0; t < thread_count; t++)
+	{
+		std::move(blocks[t].Groups.begin(), blocks[t].Groups.end(), std::back_inserter(Groups));
 
-	ShowConfig();
+		for (int g = 0; g < Constants::AvailableGroupTypes; g++)
+		{
+			GroupTypeCount[g] += blocks[t].GroupTypeCount[g];
+		}
+
+		for (int v = 0; v < Constants::AvailableVisitorTypes; v++)
+		{
+			TypeCount[v] += blocks[t].TypeCount[v];
+		}
+	}
+}
+
+
+// creates groups until at least visitor_quota visitors exist. each thread's generator is seeded
+// from the shared seed and its index, so the streams don't overlap
+void VisitorController::GenerateGroups(GeneratedGroups& block, int visitor_quota, uint32_t seed, int thread_index)
+{
+	std::seed_seq sequence{ seed, static_cast<uint32_t>(thread_index) };
+	std::mt19937 generator(sequence);
+	std::uniform_real_distribution<double> distr(0.0, 1.0);
+
+	block.Groups.reserve(visitor_quota / 2);
+
+	bool names = GetVisitorName && VisitorNames.Available();
+
+	int visitor_count = 0;
+
+	while (visitor_count < visitor_quota)
+	{
+		GroupType group_type = GetGroupType(distr(generator));
+
+		block.Groups.emplace_back(group_type, TemplateIDint, generator);
+
+		Group& group = block.Groups.back();
+
+		switch (group_type)
+		{
+		case GroupType::Family:
+			block.GroupTypeCount[0]++;
+			break;
+		case GroupType::AdultCouple:
+			block.GroupTypeCount[1]++;
+			break;
+		case GroupType::AdultGroup:
+			block.GroupTypeCount[2]++;
+			break;
+		case GroupType::Single:
+			block.GroupTypeCount[3]++;
+			break;
+		}
+
+		for (int v = 0; v < group.Visitors.size(); v++)
+		{
+			block.TypeCount[group.Visitors[v].Configuration.GetTypeAsInt()]++;
+		}
+
+		if (names)
+		{
+			for (int v = 0; v < group.Visitors.size(); v++)
+			{
+				VisitorNames.GetRandomName(generator, group.Visitors[v].Configuration.FirstName, group.Visitors[v].Configuration.LastName);
+			}
+		}
+
+		visitor_count += group.Visitors.size();
+	}
 }
 
 
@@ -164,7 +266,7 @@ void VisitorController::CalculateDemographics()
 	{
 		for (int v = 0; v < Groups[g].Visitors.size(); v++)
 		{
-			TypeCount[Groups[g].Visitors[v].Configuration.TypeInt]++;
+			TypeCount[Groups[g].Visitors[v].Configuration.GetTypeAsInt()]++;
 		}
 	}
 }
@@ -205,6 +307,18 @@ void VisitorController::OutputStatus(const std::wstring status)
 }
 
 
+// built on demand, visitors only store an index in to each name table
+std::wstring VisitorController::GetVisitorFullName(const Visitor& visitor)
+{
+	if (visitor.Configuration.FirstName == kNoName)
+	{
+		return L"";
+	}
+
+	return VisitorNames.GetName(visitor.Configuration.FirstName, visitor.Configuration.LastName);
+}
+
+
 int VisitorController::GetCurrentVisitorCount()
 {
 	int count = 0;
@@ -334,7 +448,7 @@ int VisitorController::GetLargestValueByType(int parameter)
 }
 
 
-void VisitorController::UpdateMinuteStats(const std::wstring current_time)
+void VisitorController::UpdateMinuteStats(QWaitTypes::Time current_time)
 {
  	MinuteDataV m;
 
@@ -438,25 +552,7 @@ void VisitorController::UpdateMinuteStats(const std::wstring current_time)
 }
 
 
-std::wstring VisitorController::GetMinuteDataFor(int minute)
-{
-	return std::to_wstring(Statistics[minute].visitorsInPark) + L"," +
-	       std::to_wstring(Statistics[minute].onWay) + L"," +
-		   std::to_wstring(Statistics[minute].atEntrance) + L"," +
-		   std::to_wstring(Statistics[minute].idle) + L"," +
-		   std::to_wstring(Statistics[minute].riding) + L"," +
-		   std::to_wstring(Statistics[minute].queuing) + L"," +
-		   std::to_wstring(Statistics[minute].queuingFastPass) + L"," +
-		   std::to_wstring(Statistics[minute].travelling) + L"," +
-		   std::to_wstring(Statistics[minute].waiting) + L"," +
-		   std::to_wstring(Statistics[minute].exited) + L"," +
-		   std::to_wstring(Statistics[minute].averageRides) + L"," +
-		   std::to_wstring(Statistics[minute].minRides) + L"," +
-		   std::to_wstring(Statistics[minute].maxRides);
-} 
-
-
-MinuteDataV VisitorController::GetMinuteDataStructFor(int minute)
+const MinuteDataV& VisitorController::GetMinuteDataStructFor(int minute)
 {
 	return Statistics[minute];
 }
@@ -570,46 +666,46 @@ void VisitorController::CalculateStatistics(int eatery_spending)
 			// == by type ==========================================================================================
 			// =====================================================================================================
 
-			if (visitor.Rides.count > DailyStatsByType[visitor.Configuration.TypeInt].maxRides)
+			if (visitor.Rides.count > DailyStatsByType[visitor.Configuration.GetTypeAsInt()].maxRides)
 			{
-				DailyStatsByType[visitor.Configuration.TypeInt].maxRides = visitor.Rides.count;
+				DailyStatsByType[visitor.Configuration.GetTypeAsInt()].maxRides = visitor.Rides.count;
 			}
 
-			if (visitor.Rides.count < DailyStatsByType[visitor.Configuration.TypeInt].minRides)
+			if (visitor.Rides.count < DailyStatsByType[visitor.Configuration.GetTypeAsInt()].minRides)
 			{
-				DailyStatsByType[visitor.Configuration.TypeInt].minRides = visitor.Rides.count;
+				DailyStatsByType[visitor.Configuration.GetTypeAsInt()].minRides = visitor.Rides.count;
 			}
 
 			if (visitor.Rides.count >= 50)
 			{
-				DailyStatsByType[visitor.Configuration.TypeInt].rideCount[50]++;
+				DailyStatsByType[visitor.Configuration.GetTypeAsInt()].rideCount[50]++;
 			}
 			else
 			{
-				DailyStatsByType[visitor.Configuration.TypeInt].rideCount[visitor.Rides.count]++;
+				DailyStatsByType[visitor.Configuration.GetTypeAsInt()].rideCount[visitor.Rides.count]++;
 
 				if (visitor.Rides.count == 0)
 				{
-					DailyStatsByType[visitor.Configuration.TypeInt].zeroRides++;
+					DailyStatsByType[visitor.Configuration.GetTypeAsInt()].zeroRides++;
 				}
 			}
 
-			DailyStatsByType[visitor.Configuration.TypeInt].totalRides += visitor.Rides.count;
-			DailyStatsByType[visitor.Configuration.TypeInt].totalFastPastRides += visitor.Rides.fastPassRides;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].totalRides += visitor.Rides.count;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].totalFastPastRides += visitor.Rides.fastPassRides;
 
-			DailyStatsByType[visitor.Configuration.TypeInt].totalIdleTime += visitor.TimeSpent.idle;
-			DailyStatsByType[visitor.Configuration.TypeInt].totalQueueTime += visitor.TimeSpent.queuing;
-			DailyStatsByType[visitor.Configuration.TypeInt].totalRidingTime += visitor.TimeSpent.riding;
-			DailyStatsByType[visitor.Configuration.TypeInt].totalTravellingTime += visitor.TimeSpent.travelling;
-			DailyStatsByType[visitor.Configuration.TypeInt].totalWaitingTime += visitor.TimeSpent.waiting;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].totalIdleTime += visitor.TimeSpent.idle;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].totalQueueTime += visitor.TimeSpent.queuing;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].totalRidingTime += visitor.TimeSpent.riding;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].totalTravellingTime += visitor.TimeSpent.travelling;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].totalWaitingTime += visitor.TimeSpent.waiting;
 
-			DailyStatsByType[visitor.Configuration.TypeInt].noRideAvailable += visitor.Rides.noRideAvailable;
-			DailyStatsByType[visitor.Configuration.TypeInt].waitTimeTooLong += visitor.Rides.waitTimeTooLong;
-			DailyStatsByType[visitor.Configuration.TypeInt].rideShutdown += visitor.Rides.rideShutdown;
-			DailyStatsByType[visitor.Configuration.TypeInt].distanceTravelled += visitor.Rides.distanceTravelled;
-			DailyStatsByType[visitor.Configuration.TypeInt].eateryQueueTooLong += visitor.Rides.eateryQueueTooLong;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].noRideAvailable += visitor.Rides.noRideAvailable;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].waitTimeTooLong += visitor.Rides.waitTimeTooLong;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].rideShutdown += visitor.Rides.rideShutdown;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].distanceTravelled += visitor.Rides.distanceTravelled;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].eateryQueueTooLong += visitor.Rides.eateryQueueTooLong;
 
-			DailyStatsByType[visitor.Configuration.TypeInt].typeCount++;
+			DailyStatsByType[visitor.Configuration.GetTypeAsInt()].typeCount++;
 		}
 	}
 
@@ -747,108 +843,276 @@ void VisitorController::ShowStatistics()
 // =================================================================================================================
 
 
-int VisitorController::LoadVisitorList(const std::wstring file_name)
+namespace
 {
-	int count = 0; 
+	// the start of the first "{group}" line at or after position (or size if there isn't one)
+	size_t FindGroupBoundary(std::string_view data, size_t position)
+	{
+		if (position == 0)
+		{
+			return 0;
+		}
 
-	std::wifstream file(file_name);
+		size_t boundary = data.find("\n{group}", position - 1);
 
-	if (file)
+		if (boundary == std::string_view::npos)
+		{
+			return data.size();
+		}
+
+		return boundary + 1;
+	}
+
+
+	// the next comma separated integer field; false if it is missing or not a number
+	bool NextInteger(const char*& current, const char* end, int& value)
 	{
-		OutputStatus(L"Loading Visitors from file...");
+		if (current >= end || *current != ',')
+		{
+			return false;
+		}
 
-		std::wstring s;
+		std::from_chars_result result = std::from_chars(current + 1, end, value);
 
-		while (std::getline(file, s))
+		current = result.ptr;
+
+		return result.ec == std::errc();
+	}
+
+
+	bool NextDouble(const char*& current, const char* end, double& value)
+	{
+		if (current >= end || *current != ',')
 		{
-			if (s != L"")
+			return false;
+		}
+
+		std::from_chars_result result = std::from_chars(current + 1, end, value);
+
+		current = result.ptr;
+
+		return result.ec == std::errc();
+	}
+}
+
+
+// the file is mapped in to memory and split in to one block per thread, each block starting on a
+// "{group}" line so that no group is divided between threads. blocks are parsed in place with from_chars,
+// then their groups are moved in to Groups in file order
+int VisitorController::LoadVisitorList(const std::wstring file_name)
+{
+	if (PopulationFile::IsPopulationFile(file_name))
+	{
+		OutputStatus(L"Loading Visitors from population file...");
+
+		return PopulationFile::Load(file_name, Groups, VisitorNames);
+	}
+
+	MappedFile file(file_name);
+
+	if (!file.IsOpen())
+	{
+		std::wcerr << L"Unable to load visitors from file." << std::endl;
+
+		return 0;
+	}
+
+	OutputStatus(L"Loading Visitors from file...");
+
+	std::string_view data(file.Data(), file.Size());
+
+	size_t thread_count = std::thread::hardware_concurrency();
+
+	if (thread_count > data.size() / kVisitorFileBytesPerThread)
+	{
+		thread_count = data.size() / kVisitorFileBytesPerThread;
+	}
+
+	if (thread_count < 1)
+	{
+		thread_count = 1;
+	}
+
+	std::vector<LoadedGroups> blocks(thread_count);
+	std::vector<std::future<void>> workers;
+
+	for (size_t t = 0; t < thread_count; t++)
+	{
+		workers.push_back(std::async(std::launch::async, [this, data, t, thread_count, &blocks]()
 			{
-				if (s.find(L"{group}", 0) == 0)
+				size_t start = FindGroupBoundary(data, (data.size() / thread_count) * t);
+				size_t end = data.size();
+
+				if (t + 1 < thread_count)
 				{
-					CreateGroupFromFileData(s);
+					end = FindGroupBoundary(data, (data.size() / thread_count) * (t + 1));
 				}
-				else
+
+				if (start < end)
 				{
-					if (GVisitorController->Groups[GVisitorController->Groups.size() - 1].CreateVisitorFromFileData(s))
-					{ 
-						count++;
-					}
+					ParseVisitorFileBlock(data.data() + start, data.data() + end, blocks[t]);
 				}
-			}
-		}
+			}));
+	}
 
-		file.close();
+	int count = 0;
+
+	size_t group_count = 0;
+
+	for (size_t t = 0; t < thread_count; t++)
+	{
+		workers[t].get();
+
+		group_count += blocks[t].Groups.size();
 	}
-	else
+
+	Groups.reserve(Groups.size() + group_count);
+
+	for (size_t t = 0; t < thread_count; t++)
 	{
-		std::wcerr << L"Unable to load visitors from file." << std::endl;
+		for (int e = 0; e < blocks[t].Errors.size(); e++)
+		{
+			std::wcerr << L"There appears to be some dodgy data in this input row:" << "\n";
+			std::wcerr << L"    \"" << blocks[t].Errors[e].c_str() << L"\"" << std::endl;
+		}
+
+		std::move(blocks[t].Groups.begin(), blocks[t].Groups.end(), std::back_inserter(Groups));
+
+		count += blocks[t].VisitorCount;
 	}
 
 	return count;
 }
 
 
-bool VisitorController::CreateGroupFromFileData(const std::wstring input)
+// parses the lines [begin, end). "{group}" lines hold 8 integers:
+//     type, template id, stay duration, staying on site, arrival hours, arrival minutes, depart hours, depart minutes
+// every other line is a visitor of the most recent group:
+//     name, type, age, max wait time, preference
+void VisitorController::ParseVisitorFileBlock(const char* begin, const char* end, LoadedGroups& block)
 {
-	std::wifstream visitorinput(input);
-	std::vector<std::wstring> parameters;
-	std::wstring parameter;
+	static const std::string_view kGroupTag = "{group}";
 
-	while (std::getline(visitorinput, parameter, L','))
-	{
-		parameters.push_back(parameter);
-	}
+	const char* line = begin;
 
-	if (parameters.size() == 9)
+	while (line < end)
 	{
-		int Type = 0;
-		int TemplateID = 0;
-		int StayDuration = 0;
-		bool StayingOnSite = false;
-		int ArrivalHours = 0;
-		int ArrivalMinutes = 0;
-		int DepartHours = 0;
-		int DepartMinutes = 0;
+		const char* line_end = static_cast<const char*>(memchr(line, '\n', end - line));
 
-		try
+		if (line_end == nullptr)
 		{
-			Type = stoi(parameters[1]);
+			line_end = end;
+		}
 
-			TemplateID = stof(parameters[2]);
-			StayDuration = stof(parameters[3]);
-			StayingOnSite = stoi(parameters[4]);
+		const char* next_line = line_end + 1;
 
-			ArrivalHours = stoi(parameters[5]);
-			ArrivalMinutes = stoi(parameters[6]);
-			DepartHours = stoi(parameters[7]);
-			DepartMinutes = stoi(parameters[8]);
+		if (line_end > line && *(line_end - 1) == '\r')
+		{
+			line_end--;
+		}
 
-			Group group(Type, TemplateID, StayDuration, StayingOnSite, ArrivalHours, ArrivalMinutes, DepartHours, DepartMinutes);
+		if (line_end > line)
+		{
+			bool valid = false;
 
-			Groups.push_back(group);
+			if (std::string_view(line, line_end - line).compare(0, kGroupTag.size(), kGroupTag) == 0)
+			{
+				if (block.Groups.size() != 0)
+				{
+					block.Groups.back().VisitorsLoaded();
+				}
 
-			return true;
-		}
-		catch (...)
-		{
-			std::wcerr << L"There appears to be some dodgy data in this input row:" << "\n";
-			std::wcerr << L"    \"" << input << L"\"" << std::endl;
+				const char* current = line + kGroupTag.size();
+
+				int fields[8];
+
+				valid = true;
+
+				for (int f = 0; f < 8 && valid; f++)
+				{
+					valid = NextInteger(current, line_end, fields[f]);
+				}
+
+				if (valid && current == line_end)
+				{
+					block.Groups.emplace_back(fields[0], fields[1], fields[2], fields[3] != 0, fields[4], fields[5], fields[6], fields[7]);
+				}
+				else
+				{
+					valid = false;
+				}
+			}
+			else if (block.Groups.size() != 0)
+			{
+				// the name is not used by Visitor, so it is skipped rather than converted
+				const char* current = static_cast<const char*>(memchr(line, ',', line_end - line));
+
+				NewVisitorConfiguration visitor;
+
+				int type = 0;
+				int age = 0;
+
+				if (current != nullptr &&
+					NextInteger(current, line_end, type) &&
+					NextInteger(current, line_end, age) &&
+					NextDouble(current, line_end, visitor.maxWaitTime) &&
+					NextDouble(current, line_end, visitor.preference) &&
+					current == line_end)
+				{
+					visitor.type = QWaitTypes::IntToVisitorType(type);
+
+					switch (age)
+					{
+					case 0:
+						visitor.age = AgeGroup::Baby;
+						break;
+					case 1:
+						visitor.age = AgeGroup::Child;
+						break;
+					case 2:
+						visitor.age = AgeGroup::Adult;
+						break;
+					}
+
+					block.Groups.back().Visitors.emplace_back(visitor);
+
+					block.VisitorCount++;
+
+					valid = true;
+				}
+			}
+
+			if (!valid)
+			{
+				block.Errors.push_back(std::string(line, line_end - line));
+			}
 		}
+
+		line = next_line;
 	}
-	else
+
+	if (block.Groups.size() != 0)
 	{
-		std::wcerr << L"Invalid number of parameters in this visitor data (should be 9): " << parameters.size() << "\n";
-		std::wcerr << L"    \"" << input << L"\"" << std::endl;
+		block.Groups.back().VisitorsLoaded();
 	}
-
-	return false;
 }
 
 
+
+
 // saves the randomly generated visitors (without any stats or sim information)
 // this is useful if you want to rerun a sim using a specific visitor configuration
 void VisitorController::SaveVisitorList(const std::wstring file_name)
 {
+	if (PopulationFile::IsPopulationFile(file_name))
+	{
+		OutputStatus(L"Saving as Visitor population file...");
+
+		PopulationFile::Save(file_name, Groups, VisitorNames);
+
+		return;
+	}
+
 	std::wofstream file(file_name);
 
 	if (file)
@@ -859,13 +1123,13 @@ void VisitorController::SaveVisitorList(const std::wstring file_name)
 		{
 			Group gx = Groups[g];
 
-			file << L"{group}," << gx.Configuration.GetTypeToInt() << L"," << gx.Configuration.templateID << L"," << gx.Configuration.stayDuration << L"," << gx.Configuration.stayingOnSite << L"," << gx.Configuration.arrivalTime.hours << L"," << gx.Configuration.arrivalTime.minutes << L"," << gx.Configuration.departureTime.hours << L"," << gx.Configuration.departureTime.minutes << "\n";
+			file << L"{group}," << gx.Configuration.GetTypeToInt() << L"," << gx.Configuration.templateID << L"," << gx.Configuration.stayDuration << L"," << gx.Configuration.stayingOnSite << L"," << QWaitTypes::Hour(gx.Configuration.arrivalTime) << L"," << QWaitTypes::Minute(gx.Configuration.arrivalTime) << L"," << QWaitTypes::Hour(gx.Configuration.departureTime) << L"," << QWaitTypes::Minute(gx.Configuration.departureTime) << "\n";
 
 			for (int v = 0; v < Groups[g].Visitors.size(); v++)
 			{
 				Visitor vx = Groups[g].Visitors[v];
 
-				file << vx.Configuration.Name << "," << vx.Configuration.TypeInt << "," << vx.Configuration.GetAgeAsInt() << "," << vx.Rides.maxWaitTime << "," << vx.Rides.preference << "\n";
+				file << GetVisitorFullName(vx) << "," << vx.Configuration.GetTypeAsInt() << "," << vx.Configuration.GetAgeAsInt() << "," << vx.Rides.maxWaitTime << "," << vx.Rides.preference << "\n";
 			}
 		}
 
@@ -13,12 +13,14 @@
 #pragma once
 
 
+#include <cstdint>
 #include <string>
 #include <time.h>
 #include <vector>
 
 #include "Constants.h"
 #include "Group.h"
+#include "GroupHotState.h"
 #include "Visitor.h"
 #include "VisitorController.h"
 
@@ -38,9 +40,12 @@ static const int kDailyStatsHighestAverageRideCountByValue = 11;
 
 static const int kDailyRideCount = 51;
 
+static const int kVisitorsPerGenerationThread = 25000;	// smaller populations use fewer threads
+static const size_t kVisitorFileBytesPerThread = 1024 * 1024;	// smaller visitor files are parsed on fewer threads
+
 
 struct MinuteDataV {
-	std::wstring time = L"";
+	QWaitTypes::Time time = 0;	// formatted only when a report is written
 
 	int visitorsInPark = 0;
 
@@ -119,6 +124,25 @@ struct DailyStatistics {
 };
 
 
+// the output of one visitor generation thread
+struct GeneratedGroups {
+	std::vector<Group> Groups;
+
+	int GroupTypeCount[Constants::AvailableGroupTypes] = { 0 };
+	int TypeCount[Constants::AvailableVisitorTypes] = { 0 };
+};
+
+
+// the groups parsed from one block of a visitor file
+struct LoadedGroups {
+	std::vector<Group> Groups;
+
+	int VisitorCount = 0;
+
+	std::vector<std::string> Errors;		// the offending lines, reported once parsing is finished
+};
+
+
 struct StatsFastPass {
 	size_t ticketsEarly = 0;
 	size_t ticketsEarlyAll = 0;
@@ -143,7 +167,10 @@ class VisitorController
 
 	GroupType GetGroupType(double);
 
-	bool CreateGroupFromFileData(const std::wstring);
+	void GenerateVisitors();
+	void GenerateGroups(GeneratedGroups&, int, uint32_t, int);
+
+	void ParseVisitorFileBlock(const char*, const char*, LoadedGroups&);
 
 	void OutputStatus(const std::wstring);
 
@@ -166,23 +193,28 @@ public:
 
 	std::vector<Group> Groups;
 
+	GroupHotState HotState;		// per-minute state of every group, set up by Run
+
 	VisitorController(int, bool, bool, ParkTemplate, bool);
 
 	int LoadVisitorList(const std::wstring);
 	void SaveVisitorList(const std::wstring);
 
+	Names VisitorNames;
+
 	void ShowConfig();
 	void Run(bool, const std::wstring, bool, const std::wstring);
 
+	std::wstring GetVisitorFullName(const Visitor&);
+
 	int GetCurrentVisitorCount();
 
 	int GetLargestValueByType(int);
 
 	int TotalSpending();
 
-	void UpdateMinuteStats(const std::wstring);
-	std::wstring GetMinuteDataFor(int);
-	MinuteDataV GetMinuteDataStructFor(int);
+	void UpdateMinuteStats(QWaitTypes::Time);
+	const MinuteDataV& GetMinuteDataStructFor(int);
 
 	void CalculateDemographics();
 
@@ -0,0 +1,330 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <thread>
+
+#include "Constants.h"
+#include "WalkwayGraph.h"
+
+
+namespace
+{
+	const double kUnreachable = std::numeric_limits<double>::infinity();
+
+	std::vector<std::wstring> SplitOnComma(const std::wstring input)
+	{
+		std::vector<std::wstring> parts;
+
+		size_t start = 0;
+		size_t comma;
+
+		while ((comma = input.find(L',', start)) != std::wstring::npos)
+		{
+			parts.push_back(input.substr(start, comma - start));
+
+			start = comma + 1;
+		}
+
+		parts.push_back(input.substr(start));
+
+		return parts;
+	}
+
+	bool ToInteger(const std::wstring input, int& value)
+	{
+		try
+		{
+			size_t used = 0;
+
+			value = std::stoi(input, &used);
+
+			return used == input.length();
+		}
+		catch (...)
+		{
+			return false;
+		}
+	}
+}
+
+
+bool WalkwayGraph::IsEmpty() const
+{
+	return Paths.size() == 0;
+}
+
+
+// "entrance", "rideN" or "junctionN"
+bool WalkwayGraph::ParsePoint(const std::wstring input, WalkwayPoint& point)
+{
+	if (input == L"entrance")
+	{
+		point = { WalkwayPointType::Entrance, 0 };
+
+		return true;
+	}
+	else if (input.rfind(L"ride", 0) == 0)
+	{
+		point.type = WalkwayPointType::Ride;
+
+		return ToInteger(input.substr(4), point.id) && point.id > 0;
+	}
+	else if (input.rfind(L"junction", 0) == 0)
+	{
+		point.type = WalkwayPointType::Junction;
+
+		return ToInteger(input.substr(8), point.id) && point.id > 0;
+	}
+
+	return false;
+}
+
+
+// "from,to" or "from,to,length"
+bool WalkwayGraph::ParsePath(const std::wstring input, WalkwayPath& path)
+{
+	std::vector<std::wstring> parts = SplitOnComma(input);
+
+	if (parts.size() < 2 || parts.size() > 3)
+	{
+		return false;
+	}
+
+	if (!ParsePoint(parts[0], path.from) || !ParsePoint(parts[1], path.to))
+	{
+		return false;
+	}
+
+	path.length = 0;
+
+	if (parts.size() == 3)
+	{
+		return ToInteger(parts[2], path.length) && path.length >= 0;
+	}
+
+	return true;
+}
+
+
+// "x,y"
+bool WalkwayGraph::ParseJunction(const std::wstring input, QWaitTypes::Coords& position)
+{
+	std::vector<std::wstring> parts = SplitOnComma(input);
+
+	if (parts.size() != 2)
+	{
+		return false;
+	}
+
+	return ToInteger(parts[0], position.x) && ToInteger(parts[1], position.y);
+}
+
+
+// rides must be in their final order; they're matched to the template's ride numbers by templateID
+bool WalkwayGraph::Build(const std::vector<Ride>& rides, QWaitTypes::Coords entrance)
+{
+	int location_count = rides.size() + 1;
+
+	std::vector<int> ride_vertex;			// template ride number -> vertex
+
+	for (int r = 0; r < rides.size(); r++)
+	{
+		int id = rides[r].RideOperation.templateID;
+
+		if (id > 0)
+		{
+			if (id >= ride_vertex.size())
+			{
+				ride_vertex.resize(id + 1, -1);
+			}
+
+			ride_vertex[id] = r;
+		}
+	}
+
+	auto vertex_of = [&](const WalkwayPoint& point, int& vertex, QWaitTypes::Coords& position) -> bool
+	{
+		switch (point.type)
+		{
+		case WalkwayPointType::Entrance:
+			vertex = rides.size();
+			position = entrance;
+
+			return true;
+
+		case WalkwayPointType::Ride:
+			if (point.id < ride_vertex.size() && ride_vertex[point.id] != -1)
+			{
+				vertex = ride_vertex[point.id];
+				position = rides[vertex].RideOperation.position;
+
+				return true;
+			}
+
+			return false;
+
+		case WalkwayPointType::Junction:
+			if (point.id <= Junctions.size())
+			{
+				vertex = location_count + point.id - 1;
+				position = Junctions[point.id - 1];
+
+				return true;
+			}
+
+			return false;
+		}
+
+		return false;
+	};
+
+	Adjacent.assign(location_count + Junctions.size(), {});
+
+	bool valid = true;
+
+	for (int p = 0; p < Paths.size(); p++)
+	{
+		int from;
+		int to;
+
+		QWaitTypes::Coords from_position;
+		QWaitTypes::Coords to_position;
+
+		if (!vertex_of(Paths[p].from, from, from_position) || !vertex_of(Paths[p].to, to, to_position))
+		{
+			std::wcerr << L"Walkway path" << p + 1 << L" : refers to a ride or junction that doesn't exist." << std::endl;
+
+			valid = false;
+
+			continue;
+		}
+
+		double metres = Paths[p].length;
+
+		if (metres == 0)
+		{
+			int dx = abs(from_position.x - to_position.x);
+			int dy = abs(from_position.y - to_position.y);
+
+			metres = sqrt((double)dx * dx + dy * dy);
+		}
+
+		Adjacent[from].push_back({ to, metres });
+		Adjacent[to].push_back({ from, metres });
+	}
+
+	return valid;
+}
+
+
+void WalkwayGraph::ShortestFrom(int source, std::vector<double>& metres) const
+{
+	typedef std::pair<double, int> Entry;
+
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> frontier;
+
+	metres.assign(Adjacent.size(), kUnreachable);
+
+	metres[source] = 0;
+
+	frontier.push({ 0, source });
+
+	while (!frontier.empty())
+	{
+		Entry e = frontier.top();
+
+		frontier.pop();
+
+		if (e.first > metres[e.second])
+		{
+			continue;
+		}
+
+		for (const Edge& edge : Adjacent[e.second])
+		{
+			double d = e.first + edge.metres;
+
+			if (d < metres[edge.to])
+			{
+				metres[edge.to] = d;
+
+				frontier.push({ d, edge.to });
+			}
+		}
+	}
+}
+
+
+// writes the walkway distance (metres) and walk time (minutes) between every pair of locations in to
+// the cache, which must already hold the straight-line values. returns the number of pairs with no route
+int WalkwayGraph::FillCache(DistanceMatrix& cache, int location_count) const
+{
+	size_t thread_count = std::thread::hardware_concurrency();
+
+	if (thread_count == 0)
+	{
+		thread_count = 1;
+	}
+
+	if (thread_count > location_count)
+	{
+		thread_count = location_count;
+	}
+
+	std::atomic<int> next_source = 0;
+	std::atomic<int> unreachable = 0;
+
+	// each source writes only the pairs where it's the lower location, so no two threads share a value
+	auto worker = [&]()
+	{
+		std::vector<double> metres;
+
+		int source;
+
+		while ((source = next_source++) < location_count)
+		{
+			ShortestFrom(source, metres);
+
+			for (int to = source + 1; to < location_count; to++)
+			{
+				if (metres[to] == kUnreachable)
+				{
+					unreachable++;
+				}
+				else
+				{
+					cache.Set(source, to, static_cast<int>(metres[to]), static_cast<int>(metres[to] / Constants::WalkSpeedMetresPerMinute) + 3);
+				}
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+
+	for (size_t i = 0; i < thread_count; i++)
+	{
+		workers.emplace_back(worker);
+	}
+
+	for (size_t i = 0; i < workers.size(); i++)
+	{
+		workers[i].join();
+	}
+
+	return unreachable;
+}
\ No newline at end of file
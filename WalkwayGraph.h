@@ -0,0 +1,82 @@
+// =======================================================================
+//
+// QWait, theme park modeller
+//
+// (c) Paul Alan Freshney 2022
+// paul@freshney.org
+//
+// https://github.com/MaximumOctopus/QWait
+// 
+// =======================================================================
+
+
+#pragma once
+
+
+#include <string>
+#include <vector>
+
+#include "DistanceMatrix.h"
+#include "QWaitTypes.h"
+#include "Ride.h"
+
+
+enum class WalkwayPointType { Entrance = 0, Ride = 1, Junction = 2 };
+
+
+// one end of a path; id is the ride or junction number as written in the template (1..n)
+struct WalkwayPoint {
+	WalkwayPointType type = WalkwayPointType::Entrance;
+	int id = 0;
+};
+
+
+struct WalkwayPath {
+	WalkwayPoint from;
+	WalkwayPoint to;
+
+	int length = 0;		// metres, 0 = the straight line between the two ends
+};
+
+
+// the optional [walkways] section of a template:
+//
+//   [walkways]
+//   junctioncount=2
+//   pathcount=3
+//   junction1=120,300
+//   junction2=-40,410
+//   path1=entrance,junction1
+//   path2=junction1,ride3
+//   path3=ride3,junction2,250
+//
+// when a park has walkways every location-to-location walk is the shortest route along them, worked out
+// once as the park is built (one Dijkstra per location, run in parallel) and stored in the walk cache,
+// so looking up a walk is the same table read it is for straight-line parks. locations with no route
+// between them fall back to the straight line
+class WalkwayGraph
+{
+	struct Edge {
+		int to = 0;
+		double metres = 0;
+	};
+
+	std::vector<std::vector<Edge>> Adjacent;		// locations (rides, then the entrance), then junctions
+
+	void ShortestFrom(int, std::vector<double>&) const;
+
+public:
+
+	std::vector<QWaitTypes::Coords> Junctions;
+	std::vector<WalkwayPath> Paths;
+
+	bool IsEmpty() const;
+
+	bool Build(const std::vector<Ride>&, QWaitTypes::Coords);
+
+	int FillCache(DistanceMatrix&, int) const;
+
+	static bool ParsePoint(const std::wstring, WalkwayPoint&);
+	static bool ParsePath(const std::wstring, WalkwayPath&);
+	static bool ParseJunction(const std::wstring, QWaitTypes::Coords&);
+};
\ No newline at end of file